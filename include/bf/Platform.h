@@ -1,3 +1,6 @@
 
 #include "platform/bf_platform.h"
 #include "platform/bf_platform_event.h"
+#include "platform/bf_platform_gamepad.h"
+#include "platform/bf_platform_profile.h"
+#include "platform/bf_platform_vm.h"
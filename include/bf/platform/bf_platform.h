@@ -96,6 +96,9 @@ extern "C" {
 struct bfEvent;
 typedef struct bfEvent bfEvent;
 
+struct bfEventCompact;
+typedef struct bfEventCompact bfEventCompact;
+
 typedef enum
 {
   BIFROST_PLATFORM_GFX_VUlKAN,
@@ -105,20 +108,61 @@ typedef enum
 
 typedef void* (*bfPlatformAllocator)(void* ptr, size_t old_size, size_t new_size, void* user_data);
 
+/*!
+ * @brief
+ *   Allocates `size` bytes aligned to `alignment` (a power of two, at least a pointer)
+ *   when `ptr` is NULL, otherwise frees `ptr` which was allocated with the same size
+ *   and alignment and returns NULL.
+ */
+typedef void* (*bfPlatformAlignedAllocator)(void* ptr, size_t size, size_t alignment, void* user_data);
+
+typedef enum
+{
+  BF_PLATFORM_EVENT_MODE_CALLBACK, /*!< (Default) Events are sent to 'bfWindow::event_fn' from within 'bfPlatformPumpEvents'. */
+  BF_PLATFORM_EVENT_MODE_QUEUED,   /*!< Events are buffered by 'bfPlatformPumpEvents' and drained with 'bfPlatformPollEvents'. */
+
+} bfPlatformEventMode;
+
+typedef enum
+{
+  BF_PLATFORM_REDRAW_CONTINUOUS, /*!< (Default) 'bfPlatformDoMainLoop' calls 'bfWindow::frame_fn' as fast as it can.                                 */
+  BF_PLATFORM_REDRAW_ON_DEMAND,  /*!< 'bfPlatformDoMainLoop' sleeps in 'bfPlatformWaitEvents' and only calls 'bfWindow::frame_fn' once the window is dirty. */
+
+} bfPlatformRedrawMode;
+
+typedef enum
+{
+  BF_PLATFORM_LOOP_UNCAPPED,       /*!< (Default) 'bfPlatformDoMainLoop' does not limit how often 'bfWindow::frame_fn' is called.                                                */
+  BF_PLATFORM_LOOP_TARGET_FPS,     /*!< 'bfWindow::frame_fn' is called at most 'target_fps' times a second, sleeping then spinning out the last bit for accuracy.             */
+  BF_PLATFORM_LOOP_FIXED_TIMESTEP, /*!< 'bfWindow::update_fn' is called 'target_fps' times a second of elapsed time, 'bfWindow::frame_fn' once a loop with 'bfPlatformFrameAlpha'. */
+
+} bfPlatformLoopMode;
+
+#define k_bfPlatformDefaultTargetFPS 60 /*!< Used when 'bfPlatformInitParams::target_fps' is 0. */
+
 typedef struct
 {
-  int                 argc;      /*!< Argc from the main, could be 0.                                                                                             */
-  char**              argv;      /*!< Argv from the main, allowed to be NULL                                                                                      */
-  bfPlatformAllocator allocator; /*!< Custom allocator if you wanted to control where the platform gets it's memory from, if NULL will use the default allocator. */
-  void*               user_data; /*!< User data for keeping tack some some global state, could be NULL.                                                           */
+  int                        argc;              /*!< Argc from the main, could be 0.                                                                                                                   */
+  char**                     argv;              /*!< Argv from the main, allowed to be NULL                                                                                                            */
+  bfPlatformAllocator        allocator;         /*!< Custom allocator if you wanted to control where the platform gets it's memory from, if NULL will use the default allocator.                       */
+  void*                      user_data;         /*!< User data for keeping tack some some global state, could be NULL.                                                                                 */
+  bfPlatformEventMode        event_mode;        /*!< How events are delivered to the application, zero initializing gives you 'BF_PLATFORM_EVENT_MODE_CALLBACK'.                                       */
+  bfPlatformRedrawMode       redraw_mode;       /*!< When 'bfPlatformDoMainLoop' renders a frame, zero initializing gives you 'BF_PLATFORM_REDRAW_CONTINUOUS'.                                         */
+  bfPlatformLoopMode         loop_mode;         /*!< How 'bfPlatformDoMainLoop' paces frames, zero initializing gives you 'BF_PLATFORM_LOOP_UNCAPPED'.                                                 */
+  uint32_t                   target_fps;        /*!< Frames a second for 'BF_PLATFORM_LOOP_TARGET_FPS', steps a second for 'BF_PLATFORM_LOOP_FIXED_TIMESTEP', 0 means 60.                              */
+  uint32_t                   background_fps;    /*!< Most frames a second 'bfPlatformDoMainLoop' runs while no window has focus, 0 does not throttle.                                                  */
+  bfPlatformAlignedAllocator aligned_allocator; /*!< Used by 'bfPlatformAllocAligned', if NULL the default is used with the default 'allocator' otherwise a custom 'allocator' is over allocated from. */
 
 } bfPlatformInitParams;
 
 struct bfWindow;
 typedef void (*bfWindowEventFn)(struct bfWindow* window, bfEvent* event);
 typedef void (*bfWindowFrameFn)(struct bfWindow* window);
+typedef void (*bfWindowUpdateFn)(struct bfWindow* window, float dt);
+typedef void (*bfPlatformMainThreadFn)(void* user_data);
 
 #define k_bfPlatformForceEnumSize (0x7FFFFFFF)
+#define k_bfWindowIndexInvalid    (0xFFFF)
 
 enum
 {
@@ -140,13 +184,26 @@ enum
   k_bfWindowFlagsMax = k_bfPlatformForceEnumSize
 };
 
+enum
+{
+  /* Event Coalescing Flags */
+  k_bfWindowCoalesceNone        = 0x0,
+  k_bfWindowCoalesceMouseMove   = (1 << 0), /*!< Consecutive mouse moves are merged into one event with the final position. */
+  k_bfWindowCoalesceScrollWheel = (1 << 1), /*!< Consecutive scroll wheel events are merged into one event with the summed offsets. */
+
+  /* Meta Flags */
+  k_bfWindowCoalesceAll = k_bfWindowCoalesceMouseMove |
+                          k_bfWindowCoalesceScrollWheel,
+};
+
 typedef struct bfWindow
 {
-  void*           handle;
-  void*           user_data;
-  void*           renderer_data;
-  bfWindowEventFn event_fn;
-  bfWindowFrameFn frame_fn;
+  void*            handle;
+  void*            user_data;
+  void*            renderer_data;
+  bfWindowEventFn  event_fn;
+  bfWindowFrameFn  frame_fn;
+  bfWindowUpdateFn update_fn; /*!< Only called on the main window by 'BF_PLATFORM_LOOP_FIXED_TIMESTEP', `dt` is always the step size in seconds. */
 
 } bfWindow; /*!< Base class for the window, each backend can extend it in various ways. */
 
@@ -172,6 +229,93 @@ typedef int Boolean;
  */
 BF_PLATFORM_API int  bfPlatformInit(bfPlatformInitParams params);
 BF_PLATFORM_API void bfPlatformPumpEvents(void);
+
+/*!
+ * @brief
+ *   Same as 'bfPlatformPumpEvents' but puts the calling thread to sleep
+ *   until at least one event has arrived, so an idle application does not
+ *   use any CPU. 'bfPlatformWakeUp' can be used to return early.
+ */
+BF_PLATFORM_API void bfPlatformWaitEvents(void);
+
+/*!
+ * @brief
+ *   Same as 'bfPlatformWaitEvents' but gives up waiting after `timeout_ns`
+ *   nanoseconds, useful for waking up for timers and animations.
+ */
+BF_PLATFORM_API void bfPlatformWaitEventsTimeout(uint64_t timeout_ns);
+
+/*!
+ * @brief
+ *   Makes a 'bfPlatformWaitEvents' call on the main thread return,
+ *   safe to call from any thread.
+ */
+BF_PLATFORM_API void bfPlatformWakeUp(void);
+
+/*!
+ * @brief
+ *   Drains events buffered by 'bfPlatformPumpEvents' when the platform
+ *   was initialized with 'BF_PLATFORM_EVENT_MODE_QUEUED'.
+ *   Events are returned in the order they were received and
+ *   'bfEvent::receiver' is set to the window the event was meant for,
+ *   or NULL if that window was destroyed before the event was polled.
+ *   When polling from another thread do not destroy windows while a poll
+ *   is in progress since the queued receivers are cleared in place.
+ *
+ *   The queue is a lock-free single producer / single consumer ring so this
+ *   may be called from one thread other than the one pumping events, such as
+ *   a simulation thread, while the main thread keeps the OS responsive.
+ *   Only one thread may poll at a time.
+ *
+ *   Text from a 'BIFROST_EVT_ON_TEXT_INPUT' event and paths from a
+ *   'BIFROST_EVT_ON_FILE_DROP' event stay valid until the next poll no matter
+ *   how many pumps happen in between, copy them to keep them longer.
+ *
+ * @param out
+ *   Array of at least `max` events to write to.
+ *
+ * @param max
+ *   Maximum number of events to write to `out`.
+ *
+ * @return
+ *   The number of events written to `out`, if this is equal
+ *   to `max` then there may be more events left in the queue.
+ */
+BF_PLATFORM_API size_t bfPlatformPollEvents(bfEvent* out, size_t max);
+
+/*!
+ * @brief
+ *   Same as 'bfPlatformPollEvents' but writes the events
+ *   out in the 16 byte 'bfEventCompact' encoding.
+ *
+ * @param base_time
+ *   Time (from 'bfPlatformTimeNowNs') the compact timestamps are relative to.
+ */
+BF_PLATFORM_API size_t bfPlatformPollEventsCompact(bfEventCompact* out, size_t max, uint64_t base_time);
+
+/*!
+ * @brief
+ *   Queues `fn` to be called on the thread that calls 'bfPlatformPumpEvents'
+ *   at the end of the next pump, in the order they were queued.
+ *   Wakes up the main thread if it is in 'bfPlatformWaitEvents'.
+ *   Most windowing libraries only allow window state (title, size, position,
+ *   closing, ...) to be changed from the main thread so a simulation thread
+ *   should marshal those changes through here.
+ *
+ *   Like the event queue this is a single producer / single consumer ring,
+ *   only one thread other than the main thread may call this.
+ *
+ * @param fn
+ *   The function to call, must not be NULL.
+ *
+ * @param user_data
+ *   Passed to `fn`, must stay alive until `fn` has been called.
+ *
+ * @return
+ *   0 (false) - The queue was full, 'BF_PLATFORM_COMMAND_QUEUE_SIZE' commands are already waiting.
+ *   1 (true)  - `fn` will be called on the main thread.
+ */
+BF_PLATFORM_API int bfPlatformRunOnMainThread(bfPlatformMainThreadFn fn, void* user_data);
 BF_PLATFORM_API bfWindow*        bfPlatformCreateWindow(const char* title, int width, int height, uint32_t flags);
 BF_PLATFORM_API Boolean          bfWindow_wantsToClose(bfWindow* self);
 BF_PLATFORM_API void             bfWindow_show(bfWindow* self);
@@ -185,6 +329,57 @@ BF_PLATFORM_API int              bfWindow_isMinimized(bfWindow* self);
 BF_PLATFORM_API int              bfWindow_isHovered(bfWindow* self);
 BF_PLATFORM_API void             bfWindow_setTitle(bfWindow* self, const char* title);
 BF_PLATFORM_API void             bfWindow_setAlpha(bfWindow* self, float value);
+
+/*!
+ * @brief
+ *   Hides the cursor and locks it to the window for FPS style camera
+ *   controls, motion is reported raw (unaccelerated) where the OS supports it.
+ *   Read 'bfInputState::mouse_delta_x/y' or listen for
+ *   'BIFROST_EVT_ON_MOUSE_MOTION' to get the movement.
+ */
+BF_PLATFORM_API void             bfWindow_setCursorCaptured(bfWindow* self, int is_captured);
+BF_PLATFORM_API int              bfWindow_isCursorCaptured(bfWindow* self);
+
+/*!
+ * @brief
+ *   A small integer that identifies this window for as long as it is alive,
+ *   used in place of a pointer by 'bfEventCompact'.
+ */
+BF_PLATFORM_API uint16_t         bfWindow_index(bfWindow* self);
+BF_PLATFORM_API bfWindow*        bfPlatformWindowFromIndex(uint16_t index); /*!< Returns NULL if there is no window with that index. */
+
+/*!
+ * @brief
+ *   Controls whether high frequency events are merged within a single call
+ *   to 'bfPlatformPumpEvents' rather than each being dispatched separately.
+ *   Held back events are always sent before the next non coalesced event
+ *   so ordering relative to key and button events is preserved.
+ *
+ * @param self
+ *   The window to change the policy of.
+ *
+ * @param flags
+ *   Bitwise or of 'k_bfWindowCoalesce*' flags, defaults to 'k_bfWindowCoalesceNone'.
+ */
+BF_PLATFORM_API void             bfWindow_setEventCoalescing(bfWindow* self, uint32_t flags);
+
+/*!
+ * @brief
+ *   Asks for 'bfWindow::frame_fn' to be called even if no new events arrive,
+ *   only needed with 'BF_PLATFORM_REDRAW_ON_DEMAND' for things like animations.
+ *   Must be called from the main thread, other threads can go through 'bfPlatformRunOnMainThread'.
+ */
+BF_PLATFORM_API void             bfWindow_markDirty(bfWindow* self);
+
+/*!
+ * @brief
+ *   Limits how often 'bfPlatformDoMainLoop' calls this window's 'bfWindow::frame_fn',
+ *   for things like tool windows that do not need the full refresh rate.
+ *
+ * @param fps
+ *   Frames a second, 0 (the default) draws the window every loop.
+ */
+BF_PLATFORM_API void             bfWindow_setFrameRate(bfWindow* self, uint32_t fps);
 BF_PLATFORM_API void             bfPlatformDestroyWindow(bfWindow* window);
 BF_PLATFORM_API void             bfPlatformQuit(void);
 BF_PLATFORM_API float            bfPlatformGetDPIScale(void);  // TODO(SR): Bad API cuz it assumes one monitor.
@@ -195,8 +390,228 @@ BF_PLATFORM_API void*            bfPlatformDefaultAllocator(void* ptr, size_t ol
 BF_PLATFORM_API void*            bfPlatformAlloc(size_t size);
 BF_PLATFORM_API void*            bfPlatformRealloc(void* ptr, size_t old_size, size_t new_size);
 BF_PLATFORM_API void             bfPlatformFree(void* ptr, size_t old_size);
+BF_PLATFORM_API void*            bfPlatformDefaultAlignedAllocator(void* ptr, size_t size, size_t alignment, void* user_data);
+
+/*!
+ * @brief
+ *   Allocates memory aligned for SIMD types or to keep data on its own
+ *   cache line, see 'bfPlatformInitParams::aligned_allocator'.
+ *
+ * @param alignment
+ *   Must be a power of two, anything smaller than a pointer is rounded up.
+ *
+ * @return
+ *   NULL if the allocator ran out of memory.
+ */
+BF_PLATFORM_API void* bfPlatformAllocAligned(size_t size, size_t alignment);
+
+/*!
+ * @brief
+ *   Frees memory from 'bfPlatformAllocAligned', `size` and
+ *   `alignment` must match what it was allocated with.
+ */
+BF_PLATFORM_API void bfPlatformFreeAligned(void* ptr, size_t size, size_t alignment);
+
+/*!
+ * @brief
+ *   Bump allocates scratch memory that is released all at once, there are two
+ *   arenas that swap at the start of each 'bfPlatformPumpEvents' (the top of each
+ *   'bfPlatformDoMainLoop' iteration) so memory stays valid until the end of the
+ *   next pump. Grows in 'BF_PLATFORM_FRAME_BLOCK_SIZE' blocks from the platform
+ *   allocator, blocks are kept and reused. Main thread only, never freed individually.
+ *   With 'BF_PLATFORM_EVENT_MODE_QUEUED' an arena is not reset until every event
+ *   queued while it was in use has been polled, so queued events may point into it.
+ *
+ * @param alignment
+ *   Must be a power of two, 0 means the default of 'sizeof(void*)'.
+ *
+ * @return
+ *   NULL if the platform allocator ran out of memory.
+ */
+BF_PLATFORM_API void*            bfPlatformFrameAlloc(size_t size, size_t alignment);
+
+/*!
+ * @brief
+ *   Which 'bfPlatformGetMemoryStats' bucket an allocation from
+ *   the platform allocator is counted under.
+ */
+typedef enum
+{
+  BF_PLATFORM_MEMORY_TAG_GENERAL, /*!< 'bfPlatformAlloc' / 'bfPlatformRealloc', including the application's own calls. */
+  BF_PLATFORM_MEMORY_TAG_FRAME,   /*!< Blocks backing 'bfPlatformFrameAlloc'.                                          */
+  BF_PLATFORM_MEMORY_TAG_POOL,    /*!< Blocks of a 'bfPlatformPool' unless its 'tag' is changed.                       */
+  BF_PLATFORM_MEMORY_TAG_WINDOW,  /*!< Blocks of the pool backends allocate windows from.                             */
+  BF_PLATFORM_MEMORY_TAG_MAX,
+
+} bfPlatformMemoryTag;
+
+struct bfPlatformPoolBlock;
+
+/*!
+ * @brief
+ *   Hands out fixed size objects carved from 'BF_PLATFORM_POOL_BLOCK_SIZE'
+ *   blocks of the platform allocator, freed objects go on an intrusive free
+ *   list and are reused before a new block is allocated.
+ *   Zero initialize then call 'bfPlatformPool_init', not thread safe.
+ */
+typedef struct bfPlatformPool
+{
+  struct bfPlatformPoolBlock* blocks;            /*!< Every block allocated, only freed by 'bfPlatformPool_destroy'.                       */
+  void*                       free_list;         /*!< Next object to hand out, each free object stores the one after it.                   */
+  size_t                      object_size;       /*!< Stride between objects, rounded up to fit a pointer and 'alignment'.                 */
+  size_t                      alignment;         /*!< Alignment of every object returned.                                                  */
+  size_t                      objects_per_block; /*!< Number of objects each new block is split into.                                      */
+  size_t                      num_allocated;     /*!< Objects currently handed out.                                                        */
+  bfPlatformMemoryTag         tag;               /*!< Set to 'BF_PLATFORM_MEMORY_TAG_POOL' by init, may be changed before the first alloc. */
+
+} bfPlatformPool;
+
+/*!
+ * @param alignment
+ *   Must be a power of two, 0 for pointer alignment.
+ */
+BF_PLATFORM_API void  bfPlatformPool_init(bfPlatformPool* self, size_t object_size, size_t alignment);
+BF_PLATFORM_API void* bfPlatformPool_alloc(bfPlatformPool* self);
+BF_PLATFORM_API void  bfPlatformPool_free(bfPlatformPool* self, void* ptr);
+
+/*!
+ * @brief
+ *   Returns every block to the platform allocator, any objects
+ *   still allocated from the pool are invalidated.
+ */
+BF_PLATFORM_API void bfPlatformPool_destroy(bfPlatformPool* self);
+
+typedef struct
+{
+  size_t   num_allocations;   /*!< Allocations currently outstanding.                                        */
+  size_t   num_bytes;         /*!< Bytes currently outstanding.                                              */
+  size_t   peak_bytes;        /*!< Most bytes that have been outstanding at once.                           */
+  uint64_t total_allocations; /*!< Allocations ever made, a realloc counts as one.                          */
+  uint32_t frame_allocations; /*!< Allocations made between the last two starts of 'bfPlatformPumpEvents'. */
+
+} bfPlatformMemoryTagStats;
+
+typedef struct
+{
+  bfPlatformMemoryTagStats tags[BF_PLATFORM_MEMORY_TAG_MAX]; /*!< Indexed by 'bfPlatformMemoryTag'.                                  */
+  bfPlatformMemoryTagStats total;                            /*!< Every tag combined, 'peak_bytes' is the peak of the sum. */
+
+} bfPlatformMemoryStats;
+
+/*!
+ * @brief
+ *   Reports what has gone through the platform allocator, anything still
+ *   outstanding at 'bfPlatformQuit' is also printed to stderr then.
+ *   Only the main thread may use the platform allocator while tracking.
+ *
+ * @param out
+ *   Always written to, zeroed if no stats are available.
+ *
+ * @return
+ *   0 (false) - The library was built without 'BF_PLATFORM_MEMORY_STATS'.
+ *   1 (true)  - `out` has the current stats.
+ */
+BF_PLATFORM_API Boolean bfPlatformGetMemoryStats(bfPlatformMemoryStats* out);
+
+/*!
+ * @brief
+ *   Runs until `main_window` wants to close, each loop pumps events and then
+ *   calls 'bfWindow::frame_fn' on every live window that is due based on
+ *   'bfWindow_setFrameRate'. Minimized and hidden windows are skipped.
+ *
+ * @param main_window
+ *   Decides when the loop ends and receives 'bfWindow::update_fn'.
+ */
 BF_PLATFORM_API void             bfPlatformDoMainLoop(bfWindow* main_window);
 
+typedef enum
+{
+  BF_PLATFORM_FRAME_PHASE_WAIT,   /*!< Sleeping for 'BF_PLATFORM_LOOP_TARGET_FPS' or in 'bfPlatformWaitEvents' (including its callbacks). */
+  BF_PLATFORM_FRAME_PHASE_EVENTS, /*!< 'bfPlatformPumpEvents', the backend's polling and the event callbacks.                            */
+  BF_PLATFORM_FRAME_PHASE_UPDATE, /*!< Every 'bfWindow::update_fn' step.                                                                 */
+  BF_PLATFORM_FRAME_PHASE_RENDER, /*!< 'bfWindow::frame_fn'.                                                                             */
+  BF_PLATFORM_FRAME_PHASE_TOTAL,  /*!< The whole frame, all of the phases above.                                                         */
+  BF_PLATFORM_FRAME_PHASE_MAX,
+
+} bfPlatformFramePhase;
+
+typedef struct
+{
+  uint64_t min; /*!< All in nanoseconds. */
+  uint64_t avg;
+  uint64_t p50;
+  uint64_t p95;
+  uint64_t p99;
+  uint64_t max;
+
+} bfPlatformDurationStats;
+
+typedef struct
+{
+  uint32_t                num_frames;                          /*!< Number of frames the stats were computed over, 0 if none have been recorded yet. */
+  bfPlatformDurationStats phases[BF_PLATFORM_FRAME_PHASE_MAX]; /*!< Indexed by 'bfPlatformFramePhase'.                                               */
+
+} bfPlatformFrameStats;
+
+/*!
+ * @brief
+ *   Summarizes how long each phase of the most recent frames run by
+ *   'bfPlatformDoMainLoop' took. Frames skipped by 'BF_PLATFORM_REDRAW_ON_DEMAND'
+ *   are not counted. Must be called from the main thread.
+ *
+ * @param out
+ *   Always written to, zeroed if no stats are available.
+ *
+ * @return
+ *   0 (false) - The library was built without 'BF_PLATFORM_FRAME_STATS'.
+ *   1 (true)  - `out` has the stats of the last 'BF_PLATFORM_FRAME_STATS_HISTORY' frames.
+ */
+BF_PLATFORM_API Boolean          bfPlatformGetFrameStats(bfPlatformFrameStats* out);
+
+/*!
+ * @brief
+ *   How far between the last and next 'bfWindow::update_fn' step the current
+ *   frame is, for interpolating state in 'bfWindow::frame_fn' with
+ *   'BF_PLATFORM_LOOP_FIXED_TIMESTEP'.
+ *
+ * @return
+ *   A value in [0, 1), always 1 with the other loop modes.
+ */
+BF_PLATFORM_API float            bfPlatformFrameAlpha(void);
+
+/*!
+ * @brief
+ *   Reads a monotonic clock with nanosecond units, this is the same clock
+ *   used for 'bfEvent::timestamp' so input latency is just a subtraction.
+ *
+ * @return
+ *   The current time in nanoseconds from some unspecified starting point.
+ */
+BF_PLATFORM_API uint64_t         bfPlatformTimeNowNs(void);
+
+/*!
+ * @brief
+ *   The raw counter behind 'bfPlatformTimeNowNs', cheaper to read on
+ *   platforms where converting to nanoseconds takes a divide.
+ *
+ * @return
+ *   The current tick count, 'bfPlatformTickFrequency' ticks make up a second.
+ */
+BF_PLATFORM_API uint64_t         bfPlatformTicks(void);
+BF_PLATFORM_API uint64_t         bfPlatformTickFrequency(void);
+
+/*!
+ * @brief
+ *   Blocks the calling thread until 'bfPlatformTimeNowNs' reaches `deadline_ns`.
+ *   Sleeps most of the way and spins for the last bit, the spin is sized to how
+ *   late the OS has been waking us up so the deadline is hit within microseconds.
+ *   On Emscripten the browser can not be blocked so this only spins.
+ *
+ * @param deadline_ns
+ *   Absolute time on the 'bfPlatformTimeNowNs' clock, returns right away if already passed.
+ */
+BF_PLATFORM_API void             bfPlatformSleepUntil(uint64_t deadline_ns);
+
 #if __cplusplus
 }
 #endif
@@ -18,53 +18,141 @@
 
 // clang-format off
 
-// TODO: The rest of the keys...
-#define BIFROST_KEY_ESCAPE    256
-#define BIFROST_KEY_ENTER     257
-#define BIFROST_KEY_TAB       258
-#define BIFROST_KEY_LEFT      259
-#define BIFROST_KEY_RIGHT     260
-#define BIFROST_KEY_UP        261
-#define BIFROST_KEY_DOWN      262
-#define BIFROST_KEY_PAGE_UP   263
-#define BIFROST_KEY_PAGE_DOWN 264
-#define BIFROST_KEY_HOME      265
-#define BIFROST_KEY_END       266
-#define BIFROST_KEY_INSERT    267
-#define BIFROST_KEY_DELETE    268
-#define BIFROST_KEY_BACKSPACE 269
-#define BIFROST_KEY_PAD_ENTER 270
-
-#define BIFROST_KEY_SPACE ' '
-
-#define BIFROST_KEY_A     'A'
-#define BIFROST_KEY_B     'B'
-#define BIFROST_KEY_C     'C'
-#define BIFROST_KEY_D     'D'
-#define BIFROST_KEY_E     'E'
-#define BIFROST_KEY_F     'F'
-#define BIFROST_KEY_G     'G'
-#define BIFROST_KEY_H     'H'
-#define BIFROST_KEY_I     'I'
-#define BIFROST_KEY_J     'J'
-#define BIFROST_KEY_K     'K'
-#define BIFROST_KEY_L     'L'
-#define BIFROST_KEY_M     'M'
-#define BIFROST_KEY_N     'N'
-#define BIFROST_KEY_O     'O'
-#define BIFROST_KEY_P     'P'
-#define BIFROST_KEY_Q     'Q'
-#define BIFROST_KEY_R     'R'
-#define BIFROST_KEY_S     'S'
-#define BIFROST_KEY_T     'T'
-#define BIFROST_KEY_U     'U'
-#define BIFROST_KEY_V     'V'
-#define BIFROST_KEY_W     'W'
-#define BIFROST_KEY_X     'X'
-#define BIFROST_KEY_Y     'Y'
-#define BIFROST_KEY_Z     'Z'
-
-#define k_KeyCodeMax      BIFROST_KEY_PAD_ENTER
+/*
+  NOTE(SR):
+    Printable keys use the ASCII value of the character on a US keyboard,
+    every other key is in the range [256, k_KeyCodeMax].
+    These values are the same for every backend.
+*/
+
+#define BIFROST_KEY_UNKNOWN       0
+
+#define BIFROST_KEY_ESCAPE        256
+#define BIFROST_KEY_ENTER         257
+#define BIFROST_KEY_TAB           258
+#define BIFROST_KEY_LEFT          259
+#define BIFROST_KEY_RIGHT         260
+#define BIFROST_KEY_UP            261
+#define BIFROST_KEY_DOWN          262
+#define BIFROST_KEY_PAGE_UP       263
+#define BIFROST_KEY_PAGE_DOWN     264
+#define BIFROST_KEY_HOME          265
+#define BIFROST_KEY_END           266
+#define BIFROST_KEY_INSERT        267
+#define BIFROST_KEY_DELETE        268
+#define BIFROST_KEY_BACKSPACE     269
+#define BIFROST_KEY_PAD_ENTER     270
+#define BIFROST_KEY_CAPS_LOCK     271
+#define BIFROST_KEY_SCROLL_LOCK   272
+#define BIFROST_KEY_NUM_LOCK      273
+#define BIFROST_KEY_PRINT_SCREEN  274
+#define BIFROST_KEY_PAUSE         275
+#define BIFROST_KEY_MENU          276
+
+#define BIFROST_KEY_LEFT_SHIFT    277
+#define BIFROST_KEY_LEFT_CONTROL  278
+#define BIFROST_KEY_LEFT_ALT      279
+#define BIFROST_KEY_LEFT_SUPER    280
+#define BIFROST_KEY_RIGHT_SHIFT   281
+#define BIFROST_KEY_RIGHT_CONTROL 282
+#define BIFROST_KEY_RIGHT_ALT     283
+#define BIFROST_KEY_RIGHT_SUPER   284
+
+#define BIFROST_KEY_F1            290
+#define BIFROST_KEY_F2            291
+#define BIFROST_KEY_F3            292
+#define BIFROST_KEY_F4            293
+#define BIFROST_KEY_F5            294
+#define BIFROST_KEY_F6            295
+#define BIFROST_KEY_F7            296
+#define BIFROST_KEY_F8            297
+#define BIFROST_KEY_F9            298
+#define BIFROST_KEY_F10           299
+#define BIFROST_KEY_F11           300
+#define BIFROST_KEY_F12           301
+#define BIFROST_KEY_F13           302
+#define BIFROST_KEY_F14           303
+#define BIFROST_KEY_F15           304
+#define BIFROST_KEY_F16           305
+#define BIFROST_KEY_F17           306
+#define BIFROST_KEY_F18           307
+#define BIFROST_KEY_F19           308
+#define BIFROST_KEY_F20           309
+#define BIFROST_KEY_F21           310
+#define BIFROST_KEY_F22           311
+#define BIFROST_KEY_F23           312
+#define BIFROST_KEY_F24           313
+#define BIFROST_KEY_F25           314
+
+#define BIFROST_KEY_PAD_0         320
+#define BIFROST_KEY_PAD_1         321
+#define BIFROST_KEY_PAD_2         322
+#define BIFROST_KEY_PAD_3         323
+#define BIFROST_KEY_PAD_4         324
+#define BIFROST_KEY_PAD_5         325
+#define BIFROST_KEY_PAD_6         326
+#define BIFROST_KEY_PAD_7         327
+#define BIFROST_KEY_PAD_8         328
+#define BIFROST_KEY_PAD_9         329
+#define BIFROST_KEY_PAD_DECIMAL   330
+#define BIFROST_KEY_PAD_DIVIDE    331
+#define BIFROST_KEY_PAD_MULTIPLY  332
+#define BIFROST_KEY_PAD_SUBTRACT  333
+#define BIFROST_KEY_PAD_ADD       334
+#define BIFROST_KEY_PAD_EQUAL     335
+
+#define BIFROST_KEY_SPACE         ' '
+#define BIFROST_KEY_APOSTROPHE    '\''
+#define BIFROST_KEY_COMMA         ','
+#define BIFROST_KEY_MINUS         '-'
+#define BIFROST_KEY_PERIOD        '.'
+#define BIFROST_KEY_SLASH         '/'
+#define BIFROST_KEY_SEMICOLON     ';'
+#define BIFROST_KEY_EQUAL         '='
+#define BIFROST_KEY_LEFT_BRACKET  '['
+#define BIFROST_KEY_BACKSLASH     '\\'
+#define BIFROST_KEY_RIGHT_BRACKET ']'
+#define BIFROST_KEY_GRAVE_ACCENT  '`'
+
+#define BIFROST_KEY_0             '0'
+#define BIFROST_KEY_1             '1'
+#define BIFROST_KEY_2             '2'
+#define BIFROST_KEY_3             '3'
+#define BIFROST_KEY_4             '4'
+#define BIFROST_KEY_5             '5'
+#define BIFROST_KEY_6             '6'
+#define BIFROST_KEY_7             '7'
+#define BIFROST_KEY_8             '8'
+#define BIFROST_KEY_9             '9'
+
+#define BIFROST_KEY_A             'A'
+#define BIFROST_KEY_B             'B'
+#define BIFROST_KEY_C             'C'
+#define BIFROST_KEY_D             'D'
+#define BIFROST_KEY_E             'E'
+#define BIFROST_KEY_F             'F'
+#define BIFROST_KEY_G             'G'
+#define BIFROST_KEY_H             'H'
+#define BIFROST_KEY_I             'I'
+#define BIFROST_KEY_J             'J'
+#define BIFROST_KEY_K             'K'
+#define BIFROST_KEY_L             'L'
+#define BIFROST_KEY_M             'M'
+#define BIFROST_KEY_N             'N'
+#define BIFROST_KEY_O             'O'
+#define BIFROST_KEY_P             'P'
+#define BIFROST_KEY_Q             'Q'
+#define BIFROST_KEY_R             'R'
+#define BIFROST_KEY_S             'S'
+#define BIFROST_KEY_T             'T'
+#define BIFROST_KEY_U             'U'
+#define BIFROST_KEY_V             'V'
+#define BIFROST_KEY_W             'W'
+#define BIFROST_KEY_X             'X'
+#define BIFROST_KEY_Y             'Y'
+#define BIFROST_KEY_Z             'Z'
+
+#define k_KeyCodeMax              BIFROST_KEY_PAD_EQUAL
 
 // clang-format on
 
@@ -119,7 +207,7 @@ typedef enum
   BIFROST_EVT_ON_KEY_DOWN,
   BIFROST_EVT_ON_KEY_HELD,
   BIFROST_EVT_ON_KEY_UP,
-  BIFROST_EVT_ON_KEY_INPUT,
+  BIFROST_EVT_ON_KEY_INPUT, /*!< One event per codepoint, see 'BIFROST_EVT_ON_TEXT_INPUT' for the batched UTF-8 version. */
   // NOTE(Shareef): If you add any more Mouse Events then update the Event::isKeyEvent function.
 
   // Mouse Events
@@ -137,8 +225,27 @@ typedef enum
   BIFROST_EVT_ON_WINDOW_MINIMIZE,
   BIFROST_EVT_ON_WINDOW_FOCUS_CHANGED,
 
+  // File Events
+  BIFROST_EVT_ON_FILE_DROP,
+
+  // Gamepad Events
+  BIFROST_EVT_ON_GAMEPAD_CONNECTED,
+  BIFROST_EVT_ON_GAMEPAD_DISCONNECTED,
+
+  // Text Events
+  BIFROST_EVT_ON_TEXT_INPUT, /*!< All text typed within one 'bfPlatformPumpEvents' as UTF-8, see 'bfTextInputEvent'. */
+
+  // Mouse Motion Events
+  BIFROST_EVT_ON_MOUSE_MOTION, /*!< Sub-pixel position and relative delta, see 'bfMouseMotionEvent'. Not in 'k_bfEventMaskDefault'. */
+
+  // NOTE(SR): New event types go at the end so existing values (and recorded 'bfEventCompact' streams) keep their meaning.
+
 } bfEventType;
 
+#define bfEventTypeMask(type) (1u << (uint32_t)(type)) /*!< Bit for 'type' in a window's event mask. */
+#define k_bfEventMaskAll      (0xFFFFFFFFu)
+#define k_bfEventMaskDefault  (k_bfEventMaskAll & ~bfEventTypeMask(BIFROST_EVT_ON_MOUSE_MOTION)) /*!< What new windows start with, the high frequency variants are opt in. */
+
 typedef struct  //  bfKeyboardEvent_t
 {
   union
@@ -150,6 +257,22 @@ typedef struct  //  bfKeyboardEvent_t
 
 } bfKeyboardEvent;
 
+/*!
+ * @brief
+ *   Text typed into a window, consecutive input within one pump is
+ *   merged into a single event.
+ *   The text is owned by the platform and stays valid until the end
+ *   of the next call to 'bfPlatformPumpEvents', copy it to keep it longer.
+ *   With 'BF_PLATFORM_EVENT_MODE_QUEUED' it instead stays valid until the
+ *   next call to 'bfPlatformPollEvents', even from another thread.
+ */
+typedef struct  //  bfTextInputEvent_t
+{
+  const char* text;   /*!< UTF-8 encoded and NUL terminated. */
+  size_t      length; /*!< In bytes not including the NUL.   */
+
+} bfTextInputEvent;
+
 typedef struct  //  bfMouseEvent_t
 {
   int           x;
@@ -159,6 +282,21 @@ typedef struct  //  bfMouseEvent_t
 
 } bfMouseEvent;
 
+/*!
+ * @brief
+ *   Full precision variant of 'bfMouseEvent' sent as 'BIFROST_EVT_ON_MOUSE_MOTION'.
+ *   While the cursor is captured ('bfWindow_setCursorCaptured') the position
+ *   is unbounded and the delta is raw unaccelerated motion where supported.
+ */
+typedef struct  //  bfMouseMotionEvent_t
+{
+  float x;       /*!< Cursor position relative to the window, in screen coordinates. */
+  float y;       /*!< Cursor position relative to the window, in screen coordinates. */
+  float delta_x; /*!< Movement since the last motion event.                          */
+  float delta_y; /*!< Movement since the last motion event.                          */
+
+} bfMouseMotionEvent;
+
 typedef struct  //  bfScrollWheelEvent_t
 {
   double x;
@@ -174,54 +312,50 @@ typedef struct  //  bfWindowEvent_t
 
 } bfWindowEvent;
 
-#if 0
-  enum class ControllerButton : unsigned char
-  {
-    A_BUTTON,
-    B_BUTTON,
-    X_BUTTON,
-    Y_BUTTON,
-
-    LEFT_BUMPER_BUTTON,
-    RB_BUMPER_BUTTON,
+/*!
+ * @brief
+ *   Every file dropped onto a window at once, the paths are owned by the
+ *   platform and stay valid until the end of the next call to
+ *   'bfPlatformPumpEvents', copy them to keep them longer.
+ *   With 'BF_PLATFORM_EVENT_MODE_QUEUED' they instead stay valid until the
+ *   next call to 'bfPlatformPollEvents', even from another thread.
+ */
+typedef struct  //  bfFileDropEvent_t
+{
+  const char* const* paths; /*!< UTF-8 encoded and NUL terminated. */
+  size_t             count;
 
-    SELECT_BUTTON,
-    START_BUTTON,
+} bfFileDropEvent;
 
-    LEFT_STICK_BUTTON,
-    RIGHT_STICK_BUTTON,
+/*!
+ * @brief
+ *   Sent to the first window created since gamepads are not tied to a window,
+ *   see 'bf_platform_gamepad.h' for reading the pad's state.
+ */
+typedef struct  //  bfGamepadEvent_t
+{
+  int index; /*!< Which pad was (dis)connected, in the range [0, k_bfGamepadMax). */
 
-    DPAD_UP_BUTTON,
-    DPAD_RIGHT_BUTTON,
-    DPAD_DOWN_BUTTON,
-    DPAD_LEFT_BUTTON
-  };
+} bfGamepadEvent;
 
-  enum class ControllerAxis : unsigned char
-  {
-    LEFT_X_STICK,
-    LEFT_Y_STICK,
-    RIGHT_X_STICK,
-    RIGHT_Y_STICK,
-    LEFT_TRIGGER,
-    RIGHT_TRIGGER
-  };
-#endif
 
 struct bfEvent
 {
   bfEventType      type;
   uint8_t          flags;
   struct bfWindow* receiver;
+  uint64_t         timestamp; /*!< When the event was captured in nanoseconds, same clock as 'bfPlatformTimeNowNs'. */
 
   union
   {
     bfKeyboardEvent    keyboard;
+    bfTextInputEvent   text_input;
     bfMouseEvent       mouse;
+    bfMouseMotionEvent mouse_motion;
     bfScrollWheelEvent scroll_wheel;
     bfWindowEvent      window;
-    // bfControllerButton button;
-    // bfControllerAxis   axis;
+    bfFileDropEvent    file_drop;
+    bfGamepadEvent     gamepad;
   };
 
 #if __cplusplus
@@ -242,12 +376,12 @@ struct bfEvent
 
   bool isKeyEvent() const
   {
-    return isType(BIFROST_EVT_ON_KEY_DOWN) || isType(BIFROST_EVT_ON_KEY_HELD) || isType(BIFROST_EVT_ON_KEY_UP) || isType(BIFROST_EVT_ON_KEY_INPUT);
+    return isType(BIFROST_EVT_ON_KEY_DOWN) || isType(BIFROST_EVT_ON_KEY_HELD) || isType(BIFROST_EVT_ON_KEY_UP) || isType(BIFROST_EVT_ON_KEY_INPUT) || isType(BIFROST_EVT_ON_TEXT_INPUT);
   }
 
   bool isMouseEvent() const
   {
-    return isType(BIFROST_EVT_ON_MOUSE_DOWN) || isType(BIFROST_EVT_ON_MOUSE_MOVE) || isType(BIFROST_EVT_ON_MOUSE_UP);
+    return isType(BIFROST_EVT_ON_MOUSE_DOWN) || isType(BIFROST_EVT_ON_MOUSE_MOVE) || isType(BIFROST_EVT_ON_MOUSE_UP) || isType(BIFROST_EVT_ON_MOUSE_MOTION);
   }
 
   void accept()
@@ -261,12 +395,24 @@ struct bfEvent
     this->keyboard = key;
   }
 
+  bfEvent(bfEventType type, uint8_t flags, bfTextInputEvent text_input) :
+    bfEvent(type, flags)
+  {
+    this->text_input = text_input;
+  }
+
   bfEvent(bfEventType type, uint8_t flags, bfMouseEvent mouse) :
     bfEvent(type, flags)
   {
     this->mouse = mouse;
   }
 
+  bfEvent(bfEventType type, uint8_t flags, bfMouseMotionEvent mouse_motion) :
+    bfEvent(type, flags)
+  {
+    this->mouse_motion = mouse_motion;
+  }
+
   bfEvent(bfEventType type, uint8_t flags, bfScrollWheelEvent scroll_wheel) :
     bfEvent(type, flags)
   {
@@ -279,19 +425,18 @@ struct bfEvent
     this->window = window;
   }
 
-#if 0
-    Event(bfEventType type, uint8_t flags, bfControllerButton button) :
-      Event(type, target, flags)
-    {
-      this->button = button;
-    }
+  bfEvent(bfEventType type, uint8_t flags, bfFileDropEvent file_drop) :
+    bfEvent(type, flags)
+  {
+    this->file_drop = file_drop;
+  }
+
+  bfEvent(bfEventType type, uint8_t flags, bfGamepadEvent gamepad) :
+    bfEvent(type, flags)
+  {
+    this->gamepad = gamepad;
+  }
 
-    Event(bfEventType type, uint8_t flags, bfControllerAxis axis) :
-      Event(type, target, flags)
-    {
-      this->axis = axis;
-    }
-#endif
 
   // clang-format off
   // ReSharper disable once CppPossiblyUninitializedMember
@@ -303,54 +448,178 @@ struct bfEvent
 // clang-format on
 #endif
 };
-#if 0
-  struct ControllerEvent final
+
+typedef struct bfEvent bfEvent;
+
+/*!
+ * @brief
+ *   Fixed point scale of 'bfEventCompact::mouse' coordinates,
+ *   giving a quarter pixel of precision within +-8191 pixels.
+ */
+#define k_bfEventCompactMouseScale 4
+
+/*!
+ * @brief
+ *   A 16 byte encoding of a 'bfEvent' for storing large amounts of events
+ *   such as recorded input streams.
+ *   Windows are stored as their 'bfWindow_index' and the timestamp
+ *   as microseconds relative to a base time chosen by the user
+ *   which covers a little over an hour from that base time.
+ */
+typedef struct bfEventCompact
+{
+  uint8_t  type;         /*!< A 'bfEventType'.                                           */
+  uint8_t  flags;        /*!< Same as 'bfEvent::flags'.                                  */
+  uint16_t window_index; /*!< 'bfWindow_index' of the receiver or 'k_bfWindowIndexInvalid'. */
+  uint32_t time_us;      /*!< Microseconds since the base time used to encode it.        */
+
+  union
   {
-    enum Type
+    struct
     {
-      ON_CONTROLLER_CONNECTED,
-      ON_CONTROLLER_DISCONNECTED,
-    };
-
-    Type         type;
-    const char*  name;
-    unsigned int id;
-
-    ControllerEvent(Type type, const char* name, unsigned int id) :
-      type{type},
-      name{name},
-      id{id}
+      int32_t        key;
+      bfKeyModifiers modifiers;
+
+    } keyboard;
+
+    struct
     {
-    }
-  };
+      uint32_t length; /*!< Only kept for inspection, the text itself is not stored so it decodes as an empty string. */
 
-  struct FileEvent final
-  {
-    IBaseWindow& window;
-    const char** files;
-    int          num_files;
-
-    FileEvent(IBaseWindow& window, const char** files, int num_files) :
-      window{window},
-      files{files},
-      num_files{num_files}
+    } text_input;
+
+    struct
+    {
+      int16_t       x; /*!< Multiplied by 'k_bfEventCompactMouseScale'. */
+      int16_t       y; /*!< Multiplied by 'k_bfEventCompactMouseScale'. */
+      uint8_t       target_button;
+      bfButtonFlags button_state;
+
+    } mouse;
+
+    struct
+    {
+      int16_t x;       /*!< Multiplied by 'k_bfEventCompactMouseScale'. */
+      int16_t y;       /*!< Multiplied by 'k_bfEventCompactMouseScale'. */
+      int16_t delta_x; /*!< Multiplied by 'k_bfEventCompactMouseScale'. */
+      int16_t delta_y; /*!< Multiplied by 'k_bfEventCompactMouseScale'. */
+
+    } mouse_motion;
+
+    struct
+    {
+      float x;
+      float y;
+
+    } scroll_wheel;
+
+    struct
+    {
+      uint16_t      width;
+      uint16_t      height;
+      bfWindowFlags state;
+
+    } window;
+
+    struct
+    {
+      uint32_t count; /*!< Only kept for inspection, the paths are not stored so it decodes as a drop of zero paths. */
+
+    } file_drop;
+
+    struct
     {
-    }
+      int32_t index;
+
+    } gamepad;
   };
-#endif
 
-typedef struct bfEvent bfEvent;
+} bfEventCompact;
+
+typedef char bfEventCompact_SizeCheck[sizeof(bfEventCompact) == 16 ? 1 : -1];
+
+#define k_bfInputStateMaxKeys  512                         /*!< Key codes at or above this are not tracked by 'bfInputState'. */
+#define k_bfInputStateKeyWords (k_bfInputStateMaxKeys / 64) /*!< Number of 64bit words in 'bfInputState::keys'.              */
+
+/*!
+ * @brief
+ *   Snapshot of a window's input, the platform keeps a current and previous
+ *   copy per window that are swapped at the start of every 'bfPlatformPumpEvents'.
+ */
+typedef struct bfInputState
+{
+  uint64_t      keys[k_bfInputStateKeyWords]; /*!< Bit per key code, set while the key is held down.     */
+  int           mouse_x;                      /*!< Last known mouse position relative to the window.     */
+  int           mouse_y;                      /*!< Last known mouse position relative to the window.     */
+  float         mouse_delta_x;                /*!< Sum of all mouse motion since the last pump.          */
+  float         mouse_delta_y;                /*!< Sum of all mouse motion since the last pump.          */
+  bfButtonFlags buttons;                      /*!< 'BIFROST_BUTTON_*' flags currently held down.         */
+  double        scroll_x;                     /*!< Sum of all horizontal scrolling since the last pump.  */
+  double        scroll_y;                     /*!< Sum of all vertical scrolling since the last pump.    */
+
+} bfInputState;
+
 #if __cplusplus
 }
 #endif
 
 BF_PLATFORM_API bfKeyboardEvent    bfKeyboardEvent_makeKeyMod(int key, uint8_t modifiers);
 BF_PLATFORM_API bfKeyboardEvent    bfKeyboardEvent_makeCodepoint(unsigned codepoint);
+BF_PLATFORM_API bfTextInputEvent   bfTextInputEvent_make(const char* text, size_t length);
 BF_PLATFORM_API bfMouseEvent       bfMouseEvent_make(int x, int y, uint8_t target_button, bfButtonFlags button_state);
+BF_PLATFORM_API bfMouseMotionEvent bfMouseMotionEvent_make(float x, float y, float delta_x, float delta_y);
 BF_PLATFORM_API bfScrollWheelEvent bfScrollWheelEvent_make(double x, double y);
 BF_PLATFORM_API bfWindowEvent      bfWindowEvent_make(int width, int height, bfWindowFlags state);
+BF_PLATFORM_API bfFileDropEvent    bfFileDropEvent_make(const char* const* paths, size_t count);
+BF_PLATFORM_API bfGamepadEvent     bfGamepadEvent_make(int index);
 BF_PLATFORM_API struct bfEvent     bfEvent_makeImpl(bfEventType type, uint8_t flags, const void* data, size_t data_size);
 
+/*!
+ * @brief
+ *   Polled input API, the edge queries ('wasXPressed' / 'wasXReleased')
+ *   compare the input state at the end of the last two calls to
+ *   'bfPlatformPumpEvents' and do not branch on the key code.
+ *   Key codes must be less than 'k_bfInputStateMaxKeys'.
+ */
+BF_PLATFORM_API const bfInputState* bfWindow_inputState(struct bfWindow* self);
+BF_PLATFORM_API const bfInputState* bfWindow_previousInputState(struct bfWindow* self);
+BF_PLATFORM_API int                 bfWindow_isKeyDown(struct bfWindow* self, int key);
+BF_PLATFORM_API int                 bfWindow_wasKeyPressed(struct bfWindow* self, int key);
+BF_PLATFORM_API int                 bfWindow_wasKeyReleased(struct bfWindow* self, int key);
+BF_PLATFORM_API int                 bfWindow_wasButtonPressed(struct bfWindow* self, bfButtonFlags buttons);
+BF_PLATFORM_API int                 bfWindow_wasButtonReleased(struct bfWindow* self, bfButtonFlags buttons);
+BF_PLATFORM_API int                 bfInputState_isKeyDown(const bfInputState* self, int key);
+BF_PLATFORM_API void                bfInputState_keysPressed(const bfInputState* current, const bfInputState* previous, uint64_t out_keys[k_bfInputStateKeyWords]);
+BF_PLATFORM_API void                bfInputState_keysReleased(const bfInputState* current, const bfInputState* previous, uint64_t out_keys[k_bfInputStateKeyWords]);
+
+/*!
+ * @brief
+ *   Limits which events are sent to a window, events not in the mask are
+ *   dropped before the backend does any work converting them.
+ *   Where the backend allows it the OS callbacks for the masked out events are
+ *   not registered at all, except the ones 'bfInputState' is built from so the
+ *   key, button, scroll and mouse position / delta state is always kept up to date.
+ *
+ * @param self
+ *   The window to filter events for.
+ *
+ * @param mask
+ *   Bitwise or of 'bfEventTypeMask' for each wanted event type, defaults to 'k_bfEventMaskDefault'.
+ */
+BF_PLATFORM_API void                bfWindow_setEventMask(struct bfWindow* self, uint32_t mask);
+BF_PLATFORM_API uint32_t            bfWindow_eventMask(struct bfWindow* self);
+
+BF_PLATFORM_API bfEventCompact     bfEventCompact_fromEvent(const struct bfEvent* evt, uint64_t base_time);
+
+/*!
+ * @brief
+ *   Expands a compact event back out, the data that does not fit is lost:
+ *   'BIFROST_EVT_ON_TEXT_INPUT' decodes as an empty string (length 0) and
+ *   'BIFROST_EVT_ON_FILE_DROP' with no paths (count 0) so a replayed event
+ *   is always safe to read.
+ */
+BF_PLATFORM_API struct bfEvent     bfEventCompact_toEvent(const bfEventCompact* evt, uint64_t base_time);
+
 #define bfEvent_make(type, flags, data) \
   bfEvent_makeImpl((type), (flags), &data, sizeof(data))  // NOLINT(bugprone-macro-parentheses)
 
@@ -8,6 +8,9 @@ extern "C" {
 struct bfEvent;
 typedef struct bfEvent bfEvent;
 
+struct bfEventCompact;
+typedef struct bfEventCompact bfEventCompact;
+
 struct bfWindow;
 typedef struct bfWindow bfWindow;
 
@@ -0,0 +1,177 @@
+/******************************************************************************/
+/*!
+ * @file   bf_platform_gamepad.h
+ * @author Shareef Abdoul-Raheem (http://blufedora.github.io/)
+ * @brief
+ *   Polled gamepad state for every connected pad, updated once per
+ *   'bfPlatformPumpEvents'. Pads are reported with a standard layout
+ *   (Xbox style) and connecting / disconnecting one sends
+ *   'BIFROST_EVT_ON_GAMEPAD_CONNECTED' / 'BIFROST_EVT_ON_GAMEPAD_DISCONNECTED'.
+ *
+ * @version 0.0.1
+ * @date    2020-07-05
+ *
+ * @copyright Copyright (c) 2020 Shareef Abdoul-Raheem
+ */
+/******************************************************************************/
+#ifndef BF_PLATFORM_GAMEPAD_H
+#define BF_PLATFORM_GAMEPAD_H
+
+#include "bf_platform_export.h"
+
+#include <stdint.h> /* uint32_t */
+
+#if __cplusplus
+extern "C" {
+#endif
+
+#define k_bfGamepadMax 8 /*!< Maximum number of pads tracked at once. */
+
+/* NOTE(SR): Same order as GLFW's gamepad buttons and axes so the GLFW backend can copy them directly. */
+
+typedef enum
+{
+  BIFROST_GAMEPAD_BUTTON_A,
+  BIFROST_GAMEPAD_BUTTON_B,
+  BIFROST_GAMEPAD_BUTTON_X,
+  BIFROST_GAMEPAD_BUTTON_Y,
+  BIFROST_GAMEPAD_BUTTON_LEFT_BUMPER,
+  BIFROST_GAMEPAD_BUTTON_RIGHT_BUMPER,
+  BIFROST_GAMEPAD_BUTTON_BACK,
+  BIFROST_GAMEPAD_BUTTON_START,
+  BIFROST_GAMEPAD_BUTTON_GUIDE,
+  BIFROST_GAMEPAD_BUTTON_LEFT_THUMB,
+  BIFROST_GAMEPAD_BUTTON_RIGHT_THUMB,
+  BIFROST_GAMEPAD_BUTTON_DPAD_UP,
+  BIFROST_GAMEPAD_BUTTON_DPAD_RIGHT,
+  BIFROST_GAMEPAD_BUTTON_DPAD_DOWN,
+  BIFROST_GAMEPAD_BUTTON_DPAD_LEFT,
+  BIFROST_GAMEPAD_BUTTON_MAX,
+
+} bfGamepadButton;
+
+typedef enum
+{
+  BIFROST_GAMEPAD_AXIS_LEFT_X,
+  BIFROST_GAMEPAD_AXIS_LEFT_Y,
+  BIFROST_GAMEPAD_AXIS_RIGHT_X,
+  BIFROST_GAMEPAD_AXIS_RIGHT_Y,
+  BIFROST_GAMEPAD_AXIS_LEFT_TRIGGER,
+  BIFROST_GAMEPAD_AXIS_RIGHT_TRIGGER,
+  BIFROST_GAMEPAD_AXIS_MAX,
+
+} bfGamepadAxis;
+
+#define bfGamepadButtonMask(button) (1u << (uint32_t)(button)) /*!< Bit for 'button' in 'bfGamepadState::buttons'. */
+
+/*!
+ * @brief
+ *   Every pad's state laid out as contiguous arrays indexed by pad
+ *   so the whole set can be processed in one pass.
+ *   Disconnected pads read as all zeros.
+ */
+typedef struct bfGamepadState
+{
+  uint32_t connected;                                     /*!< Bit per pad index that is currently connected.                                  */
+  uint32_t buttons[k_bfGamepadMax];                       /*!< 'bfGamepadButtonMask' of the buttons held down per pad.                         */
+  float    axes[BIFROST_GAMEPAD_AXIS_MAX][k_bfGamepadMax]; /*!< Sticks in [-1, 1] (+Y is down), triggers in [0, 1], with deadzones applied. */
+
+} bfGamepadState;
+
+/*!
+ * @brief
+ *   What a 'bfGamepadSource' reports for a single pad, before any deadzone.
+ */
+typedef struct bfGamepadRawState
+{
+  uint32_t buttons;                        /*!< 'bfGamepadButtonMask' of the buttons held down. */
+  float    axes[BIFROST_GAMEPAD_AXIS_MAX]; /*!< Sticks in [-1, 1], triggers in [0, 1].          */
+
+} bfGamepadRawState;
+
+/*!
+ * @brief
+ *   Where gamepad state comes from, each backend has a default one
+ *   (GLFW gamepads or SDL game controllers) and it can be replaced with
+ *   a mock device for tests and input playback.
+ */
+typedef struct bfGamepadSource
+{
+  void* user_data;
+
+  /*!
+   * @return
+   *   0 (false) - There is no pad at `index`, `out` is ignored.
+   *   1 (true)  - The pad is connected and `out` was written to.
+   */
+  int (*poll)(void* user_data, int index, bfGamepadRawState* out);
+
+  /*!
+   * @return
+   *   A human readable name for the pad at `index`, may be NULL.
+   */
+  const char* (*name)(void* user_data, int index);
+
+} bfGamepadSource;
+
+/*!
+ * @brief
+ *   Replaces where gamepad state is read from.
+ *
+ * @param source
+ *   Copied, NULL restores the backend's default source.
+ */
+BF_PLATFORM_API void                  bfPlatformSetGamepadSource(const bfGamepadSource* source);
+BF_PLATFORM_API const bfGamepadState* bfPlatformGamepadState(void);
+BF_PLATFORM_API const bfGamepadState* bfPlatformGamepadPreviousState(void);
+
+/*!
+ * @brief
+ *   Sets the deadzones applied to every pad, anything inside is reported
+ *   as zero and the range outside is rescaled back to start at zero.
+ *
+ * @param stick
+ *   Radial deadzone for both sticks, defaults to 0.2.
+ *
+ * @param trigger
+ *   Deadzone for both triggers, defaults to 0.1.
+ */
+BF_PLATFORM_API void        bfPlatformSetGamepadDeadzone(float stick, float trigger);
+BF_PLATFORM_API int         bfGamepad_isConnected(int index);
+BF_PLATFORM_API const char* bfGamepad_name(int index);
+BF_PLATFORM_API int         bfGamepad_isButtonDown(int index, bfGamepadButton button);
+BF_PLATFORM_API int         bfGamepad_wasButtonPressed(int index, bfGamepadButton button);
+BF_PLATFORM_API int         bfGamepad_wasButtonReleased(int index, bfGamepadButton button);
+BF_PLATFORM_API float       bfGamepad_axis(int index, bfGamepadAxis axis);
+
+#if __cplusplus
+}
+#endif
+
+#endif /* BF_PLATFORM_GAMEPAD_H */
+
+/******************************************************************************/
+/*
+  MIT License
+
+  Copyright (c) 2020 Shareef Abdoul-Raheem
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+/******************************************************************************/
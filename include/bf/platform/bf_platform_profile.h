@@ -0,0 +1,103 @@
+/******************************************************************************/
+/*!
+ * @file   bf_platform_profile.h
+ * @author Shareef Abdoul-Raheem (http://blufedora.github.io/)
+ * @brief
+ *   Lightweight scoped zone instrumentation, each thread records into its own
+ *   lock free ring and the zones can be written out as a Chrome
+ *   'trace_event' JSON file (chrome://tracing, https://ui.perfetto.dev).
+ *
+ *   Build with 'BF_PLATFORM_PROFILE' set to 1 to enable, otherwise the
+ *   zone macros expand to nothing.
+ *
+ * @version 0.0.1
+ * @date    2020-07-05
+ *
+ * @copyright Copyright (c) 2020 Shareef Abdoul-Raheem
+ */
+/******************************************************************************/
+#ifndef BF_PLATFORM_PROFILE_H
+#define BF_PLATFORM_PROFILE_H
+
+#include "bf_platform_export.h"
+
+#ifndef BF_PLATFORM_PROFILE
+#define BF_PLATFORM_PROFILE 0
+#endif
+
+#if __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief
+ *   Marks the start / end of a zone on the calling thread, zones nest
+ *   and every begin must be matched by an end on the same thread.
+ *
+ *   `name` is stored by pointer so must outlive the next
+ *   'bfProfileWriteChromeTrace', string literals and __func__ work.
+ */
+#if BF_PLATFORM_PROFILE
+#define bfProfileZoneBegin(name) bfProfileRecordBegin(name)
+#define bfProfileZoneEnd()       bfProfileRecordEnd()
+#else
+#define bfProfileZoneBegin(name)
+#define bfProfileZoneEnd()
+#endif
+
+/*!
+ * @brief
+ *   What the zone macros call, use the macros instead so the
+ *   calls compile away with 'BF_PLATFORM_PROFILE' off.
+ *   A zone is recorded when it ends and is dropped whole
+ *   if the calling thread's ring is full at that point.
+ */
+BF_PLATFORM_API void bfProfileRecordBegin(const char* name);
+BF_PLATFORM_API void bfProfileRecordEnd(void);
+
+/*!
+ * @brief
+ *   Drains every thread's ring into a Chrome 'trace_event' JSON file,
+ *   zones that are still open or end after this call are in the next one.
+ *   Only one thread may export at a time.
+ *
+ * @param file_path
+ *   Where to write the trace, overwritten if it exists.
+ *
+ * @return
+ *   0 (false) - The file could not be written or the library was built without 'BF_PLATFORM_PROFILE'.
+ *   1 (true)  - The trace was written.
+ */
+BF_PLATFORM_API int bfProfileWriteChromeTrace(const char* file_path);
+
+#if __cplusplus
+}
+#endif
+
+#endif /* BF_PLATFORM_PROFILE_H */
+
+/******************************************************************************/
+/*
+  MIT License
+
+  Copyright (c) 2020 Shareef Abdoul-Raheem
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+/******************************************************************************/
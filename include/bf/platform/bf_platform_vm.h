@@ -0,0 +1,149 @@
+/******************************************************************************/
+/*!
+ * @file   bf_platform_vm.h
+ * @author Shareef Abdoul-Raheem (http://blufedora.github.io/)
+ * @brief
+ *   Reserving address space up front and committing memory to it as it is
+ *   needed, for buffers that must grow without moving or copying.
+ *
+ *   All sizes and addresses passed to commit / decommit are rounded out to
+ *   whole pages. On the web there is no virtual memory so reserving allocates
+ *   the whole range and commit / decommit do nothing.
+ *
+ * @version 0.0.1
+ * @date    2020-07-05
+ *
+ * @copyright Copyright (c) 2020 Shareef Abdoul-Raheem
+ */
+/******************************************************************************/
+#ifndef BF_PLATFORM_VM_H
+#define BF_PLATFORM_VM_H
+
+#include "bf_platform_export.h"
+
+#include <stddef.h> /* size_t */
+
+#if __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief
+ *   Granularity of commit / decommit.
+ */
+BF_PLATFORM_API size_t bfPlatformPageSize(void);
+
+/*!
+ * @return
+ *   Size of a huge / large page (2MiB on most x64 systems), 0 if the OS does not have them.
+ */
+BF_PLATFORM_API size_t bfPlatformHugePageSize(void);
+
+/*!
+ * @brief
+ *   Reserves `size` bytes of address space with nothing backing it,
+ *   touching it before a 'bfPlatformVirtualCommit' faults.
+ *
+ * @return
+ *   Page aligned start of the range, NULL if it could not be reserved.
+ */
+BF_PLATFORM_API void* bfPlatformVirtualReserve(size_t size);
+
+/*!
+ * @brief
+ *   Backs part of a reserved range with zeroed read / write memory.
+ *
+ * @return
+ *   0 (false) - The OS is out of memory, nothing was committed.
+ *   1 (true)  - The range can be used.
+ */
+BF_PLATFORM_API int bfPlatformVirtualCommit(void* ptr, size_t size);
+
+/*!
+ * @brief
+ *   Gives the memory behind part of a reserved range back to the OS, the
+ *   addresses stay reserved and read as zero once committed again.
+ */
+BF_PLATFORM_API void bfPlatformVirtualDecommit(void* ptr, size_t size);
+
+/*!
+ * @brief
+ *   Releases a whole range from 'bfPlatformVirtualReserve',
+ *   `size` must be what was reserved.
+ */
+BF_PLATFORM_API void bfPlatformVirtualRelease(void* ptr, size_t size);
+
+/*!
+ * @brief
+ *   A bump allocator over one reserved range that commits more pages as it
+ *   grows, the base never moves so pointers into it stay valid and growing
+ *   never copies. Zero initialize then call 'bfPlatformVirtualArena_init'.
+ */
+typedef struct bfPlatformVirtualArena
+{
+  unsigned char* base;      /*!< Start of the reservation, NULL before init. */
+  size_t         reserved;  /*!< Most bytes the arena can grow to.           */
+  size_t         committed; /*!< Bytes from 'base' backed by memory.         */
+  size_t         used;      /*!< Bytes handed out since the last reset.      */
+
+} bfPlatformVirtualArena;
+
+/*!
+ * @param max_size
+ *   Address space to reserve, only what is allocated is ever committed
+ *   so this can be far larger than what is expected to be used.
+ *
+ * @return
+ *   0 (false) - The address space could not be reserved.
+ *   1 (true)  - The arena is ready.
+ */
+BF_PLATFORM_API int bfPlatformVirtualArena_init(bfPlatformVirtualArena* self, size_t max_size);
+
+/*!
+ * @param alignment
+ *   Must be a power of two, 0 means the default of 'sizeof(void*)'.
+ *
+ * @return
+ *   NULL if the reservation is used up or memory could not be committed.
+ */
+BF_PLATFORM_API void* bfPlatformVirtualArena_alloc(bfPlatformVirtualArena* self, size_t size, size_t alignment);
+
+/*!
+ * @brief
+ *   Frees every allocation at once, the committed pages are kept for
+ *   reuse unless `decommit` is set.
+ */
+BF_PLATFORM_API void bfPlatformVirtualArena_reset(bfPlatformVirtualArena* self, int decommit);
+BF_PLATFORM_API void bfPlatformVirtualArena_destroy(bfPlatformVirtualArena* self);
+
+#if __cplusplus
+}
+#endif
+
+#endif /* BF_PLATFORM_VM_H */
+
+/******************************************************************************/
+/*
+  MIT License
+
+  Copyright (c) 2020 Shareef Abdoul-Raheem
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+/******************************************************************************/
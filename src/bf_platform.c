@@ -1,112 +1,1852 @@
-#include "bf/platform/bf_platform.h"
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200112L /* clock_gettime, clock_nanosleep, posix_memalign */
+#endif
+
+#include "bf_platform_internal.h"
+
+#if BIFROST_PLATFORM_EMSCRIPTEN
+#include <emscripten.h>
+#elif BIFROST_PLATFORM_WINDOWS
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h> /* QueryPerformanceCounter */
+#include <malloc.h>  /* _aligned_malloc         */
+#else
+#include <errno.h> /* EINTR                          */
+#include <time.h>  /* clock_gettime, clock_nanosleep */
+#endif
+
+#include <assert.h> /* assert                  */
+#include <stdio.h>  /* fprintf, stderr         */
+#include <stdlib.h> /* realloc, posix_memalign */
+#include <string.h> /* memcpy                  */
+
+/*!
+ * @brief
+ *   Number of events 'BF_PLATFORM_EVENT_MODE_QUEUED' can hold between calls
+ *   to 'bfPlatformPollEvents', must be a power of two.
+ */
+#ifndef BF_PLATFORM_EVENT_QUEUE_SIZE
+#define BF_PLATFORM_EVENT_QUEUE_SIZE 1024
+#endif
+
+#if (BF_PLATFORM_EVENT_QUEUE_SIZE & (BF_PLATFORM_EVENT_QUEUE_SIZE - 1)) != 0
+#error "BF_PLATFORM_EVENT_QUEUE_SIZE must be a power of two."
+#endif
+
+/*!
+ * @brief
+ *   Maximum number of windows alive at once, bounded by
+ *   'bfEventCompact::window_index' being 16 bits.
+ */
+#ifndef BF_PLATFORM_MAX_WINDOWS
+#define BF_PLATFORM_MAX_WINDOWS 64
+#endif
+
+#if BF_PLATFORM_MAX_WINDOWS > k_bfWindowIndexInvalid
+#error "BF_PLATFORM_MAX_WINDOWS must fit in 'bfEventCompact::window_index'."
+#endif
+
+/*!
+ * @brief
+ *   Number of 'bfPlatformRunOnMainThread' calls that can be waiting
+ *   for the next 'bfPlatformPumpEvents', must be a power of two.
+ */
+#ifndef BF_PLATFORM_COMMAND_QUEUE_SIZE
+#define BF_PLATFORM_COMMAND_QUEUE_SIZE 256
+#endif
+
+#if (BF_PLATFORM_COMMAND_QUEUE_SIZE & (BF_PLATFORM_COMMAND_QUEUE_SIZE - 1)) != 0
+#error "BF_PLATFORM_COMMAND_QUEUE_SIZE must be a power of two."
+#endif
+
+/*!
+ * @brief
+ *   Size of the blocks the 'bfPlatformFrameAlloc' arenas allocate from,
+ *   larger allocations get a block to themselves.
+ */
+#ifndef BF_PLATFORM_FRAME_BLOCK_SIZE
+#define BF_PLATFORM_FRAME_BLOCK_SIZE 4096
+#endif
+
+/*!
+ * @brief
+ *   Size of the blocks a 'bfPlatformPool' grows by, objects too big to
+ *   fit more than one get a block each.
+ */
+#ifndef BF_PLATFORM_POOL_BLOCK_SIZE
+#define BF_PLATFORM_POOL_BLOCK_SIZE 4096
+#endif
+
+/*!
+ * @brief
+ *   How long before a deadline (in nanoseconds) 'bfPlatformSleepUntil' starts
+ *   out spinning instead of sleeping, adjusted at runtime to how late the OS
+ *   actually wakes us up but kept within [min, max].
+ */
+#ifndef BF_PLATFORM_SLEEP_SPIN_TIME
+#define BF_PLATFORM_SLEEP_SPIN_TIME 1000000
+#endif
+
+#ifndef BF_PLATFORM_SLEEP_SPIN_MIN
+#define BF_PLATFORM_SLEEP_SPIN_MIN 50000
+#endif
+
+#ifndef BF_PLATFORM_SLEEP_SPIN_MAX
+#define BF_PLATFORM_SLEEP_SPIN_MAX 16000000
+#endif
+
+/*!
+ * @brief
+ *   Most 'bfWindow::update_fn' steps run in a single loop, after a long stall
+ *   (breakpoint, 'BF_PLATFORM_REDRAW_ON_DEMAND' wait) the rest of the time is dropped
+ *   rather than trying to catch up and falling further behind.
+ */
+#ifndef BF_PLATFORM_MAX_FIXED_STEPS
+#define BF_PLATFORM_MAX_FIXED_STEPS 8
+#endif
+
+/*!
+ * @brief
+ *   Set to 1 to have 'bfPlatformDoMainLoop' time each phase of the frame
+ *   for 'bfPlatformGetFrameStats', when 0 the timing code is compiled out.
+ */
+#ifndef BF_PLATFORM_FRAME_STATS
+#define BF_PLATFORM_FRAME_STATS 0
+#endif
+
+/*!
+ * @brief
+ *   Counts every allocation made through the platform allocator by
+ *   'bfPlatformMemoryTag' for 'bfPlatformGetMemoryStats' and reports
+ *   leaks at 'bfPlatformQuit', when 0 the bookkeeping is compiled out.
+ */
+#ifndef BF_PLATFORM_MEMORY_STATS
+#define BF_PLATFORM_MEMORY_STATS 0
+#endif
+
+/*!
+ * @brief
+ *   Number of most recent frames 'bfPlatformGetFrameStats' is computed over.
+ */
+#ifndef BF_PLATFORM_FRAME_STATS_HISTORY
+#define BF_PLATFORM_FRAME_STATS_HISTORY 256
+#endif
+
+/*
+  NOTE(SR):
+    Both queues are single producer / single consumer rings, the event queue
+    is written by the main thread and read by whichever thread polls and the
+    command queue is the other way around. 'head' is only written by the
+    reader and 'tail' only by the writer so each lives on its own cache line.
+*/
+
+typedef struct
+{
+  bfEvent events[BF_PLATFORM_EVENT_QUEUE_SIZE];
+  size_t  head;     /*!< Index of the next event to be read, only ever incremented.                         */
+  size_t  released; /*!< 'head' at the start of the last poll, text from events before this is no longer read. */
+  char    head_padding[k_bfPlatformCacheLineSize - sizeof(size_t) * 2u];
+  size_t  tail;     /*!< Index of the next event to be written, only ever incremented.                      */
+  char    tail_padding[k_bfPlatformCacheLineSize - sizeof(size_t)];
+
+} bfEventQueue;
+
+typedef struct
+{
+  bfPlatformMainThreadFn fn;
+  void*                  user_data;
+
+} bfPlatformCommand;
+
+typedef struct
+{
+  bfPlatformCommand commands[BF_PLATFORM_COMMAND_QUEUE_SIZE];
+  size_t            head; /*!< Index of the next command to be run, only ever incremented. */
+  char              head_padding[k_bfPlatformCacheLineSize - sizeof(size_t)];
+  size_t            tail; /*!< Index of the next command to be written, only ever incremented. */
+  char              tail_padding[k_bfPlatformCacheLineSize - sizeof(size_t)];
+
+} bfCommandQueue;
+
+typedef struct bfArenaBlock
+{
+  struct bfArenaBlock* next;
+  size_t               capacity; /*!< Number of bytes after this header. */
+
+} bfArenaBlock;
+
+typedef struct
+{
+  bfArenaBlock* first;
+  bfArenaBlock* current;
+  size_t        current_used; /*!< Bytes of 'current' handed out since the last reset. */
+
+} bfArena;
+
+bfPlatformInitParams      g_BifrostPlatform;
+static bfEventQueue       s_EventQueue;
+static bfCommandQueue     s_CommandQueue;
+static bfArena            s_FrameArenas[2];
+static uint8_t            s_FrameArenaIndex = 0;
+static size_t             s_FrameArenaTails[2]; /*!< 's_EventQueue' tail when each arena was last swapped out. */
+static BifrostWindowBase* s_PendingWindows = NULL;
+static BifrostWindowBase* s_Windows[BF_PLATFORM_MAX_WINDOWS];
+static uint64_t           s_LoopLastFrameTime   = 0u;   /*!< When the last paced frame was scheduled to start, see 'paceFrame'.            */
+static uint64_t           s_LoopLastStepTime    = 0u;   /*!< 'BF_PLATFORM_LOOP_FIXED_TIMESTEP' time of the last accumulate, 0 before the first. */
+static uint64_t           s_LoopStepAccumulator = 0u;   /*!< Elapsed nanoseconds not yet consumed by a 'bfWindow::update_fn' step.          */
+static float              s_LoopFrameAlpha      = 1.0f; /*!< See 'bfPlatformFrameAlpha'.                                                    */
+static uint32_t           s_NumFocusedWindows   = 0u;   /*!< Windows with 'BifrostWindowBase::is_focused' set, 0 means the app is in the background. */
+
+bfPlatformGfxAPI bfPlatformGetGfxAPI(void)
+{
+#if defined(BF_PLATFORM_USE_VULKAN)
+  return BIFROST_PLATFORM_GFX_VUlKAN;
+#elif defined(BF_PLATFORM_USE_OPENGL)
+  return BIFROST_PLATFORM_GFX_OPENGL;
+#else
+#error "One of these should be defined"
+#endif
+}
+
+/* Memory Stats */
+
+/*
+  NOTE(SR):
+    Every call into 'g_BifrostPlatform.allocator' goes through 'callAllocator'
+    so the stats see them all, with 'BF_PLATFORM_MEMORY_STATS' off the macros
+    leave nothing behind. The last slot of 's_MemoryStats' is the total.
+*/
+
+#if BF_PLATFORM_MEMORY_STATS
+#define bfMemoryStatsRecord(tag, old_ptr, old_size, new_ptr, new_size) recordMemoryStats((tag), (old_ptr), (old_size), (new_ptr), (new_size))
+#define bfMemoryStatsEndFrame()                                        endMemoryStatsFrame()
+#define bfMemoryStatsReportLeaks()                                     reportMemoryLeaks()
+
+static bfPlatformMemoryTagStats s_MemoryStats[BF_PLATFORM_MEMORY_TAG_MAX + 1];
+static uint32_t                 s_MemoryFrameAllocations[BF_PLATFORM_MEMORY_TAG_MAX + 1]; /*!< Allocations since the last 'endMemoryStatsFrame'. */
+
+static void recordMemoryStats(bfPlatformMemoryTag tag, const void* old_ptr, size_t old_size, const void* new_ptr, size_t new_size)
+{
+  const int slots[] = {(int)tag, BF_PLATFORM_MEMORY_TAG_MAX};
+  int       i;
+
+  for (i = 0; i < 2; ++i)
+  {
+    bfPlatformMemoryTagStats* const stats = &s_MemoryStats[slots[i]];
+
+    /* NOTE(SR): A failed realloc still frees `old_ptr` (see 'bfPlatformDefaultAllocator') so it is always released here. */
+    if (old_ptr)
+    {
+      stats->num_allocations -= 1u;
+      stats->num_bytes -= old_size;
+    }
+
+    if (new_ptr && new_size)
+    {
+      stats->num_allocations += 1u;
+      stats->num_bytes += new_size;
+      stats->total_allocations += 1u;
+      s_MemoryFrameAllocations[slots[i]] += 1u;
+
+      if (stats->num_bytes > stats->peak_bytes)
+      {
+        stats->peak_bytes = stats->num_bytes;
+      }
+    }
+  }
+}
+
+static void endMemoryStatsFrame(void)
+{
+  int i;
+
+  for (i = 0; i <= BF_PLATFORM_MEMORY_TAG_MAX; ++i)
+  {
+    s_MemoryStats[i].frame_allocations = s_MemoryFrameAllocations[i];
+    s_MemoryFrameAllocations[i]        = 0u;
+  }
+}
+
+static void reportMemoryLeaks(void)
+{
+  static const char* const k_TagNames[BF_PLATFORM_MEMORY_TAG_MAX] = {"general", "frame", "pool", "window"};
+  int                      i;
+
+  for (i = 0; i < BF_PLATFORM_MEMORY_TAG_MAX; ++i)
+  {
+    const bfPlatformMemoryTagStats* const stats = &s_MemoryStats[i];
+
+    if (stats->num_allocations)
+    {
+      fprintf(stderr,
+              "bfPlatformQuit: %lu '%s' allocation(s) totaling %lu bytes were never freed.\n",
+              (unsigned long)stats->num_allocations,
+              k_TagNames[i],
+              (unsigned long)stats->num_bytes);
+    }
+  }
+}
+#else
+#define bfMemoryStatsRecord(tag, old_ptr, old_size, new_ptr, new_size)
+#define bfMemoryStatsEndFrame()
+#define bfMemoryStatsReportLeaks()
+#endif
+
+Boolean bfPlatformGetMemoryStats(bfPlatformMemoryStats* out)
+{
+  memset(out, 0x0, sizeof(*out));
+
+#if BF_PLATFORM_MEMORY_STATS
+  memcpy(out->tags, s_MemoryStats, sizeof(out->tags));
+  out->total = s_MemoryStats[BF_PLATFORM_MEMORY_TAG_MAX];
+
+  return 1;
+#else
+  return 0;
+#endif
+}
+
+static void* callAllocator(void* ptr, size_t old_size, size_t new_size, bfPlatformMemoryTag tag)
+{
+  void* const result = g_BifrostPlatform.allocator(ptr, old_size, new_size, g_BifrostPlatform.user_data);
+
+  bfMemoryStatsRecord(tag, ptr, old_size, result, new_size);
+  (void)tag;
+
+  return result;
+}
+
+void* bfPlatformDefaultAllocator(void* ptr, size_t old_size, size_t new_size, void* user_data)
+{
+  (void)user_data;
+  (void)old_size;
+
+  /*
+    NOTE(Shareef):
+      "if new_size is zero, the behavior is implementation defined
+      (null pointer may be returned in which case the old memory block may or may not be freed),
+      or some non-null pointer may be returned that may
+      not be used to access storage."
+  */
+  if (new_size == 0u)
+  {
+    free(ptr);
+    ptr = NULL;
+  }
+  else
+  {
+    void* const new_ptr = realloc(ptr, new_size);
+
+    if (!new_ptr)
+    {
+      /*
+        NOTE(Shareef):
+          As to not leak memory, realloc says:
+            "If there is not enough memory,
+            the old memory block is not freed and null pointer is returned."
+      */
+      free(ptr);
+    }
+
+    ptr = new_ptr;
+  }
+
+  return ptr;
+}
+
+void* bfPlatformDefaultAlignedAllocator(void* ptr, size_t size, size_t alignment, void* user_data)
+{
+  (void)user_data;
+
+  if (ptr)
+  {
+#if BIFROST_PLATFORM_WINDOWS
+    _aligned_free(ptr);
+#else
+    free(ptr);
+#endif
+    return NULL;
+  }
+
+#if BIFROST_PLATFORM_WINDOWS
+  return _aligned_malloc(size, alignment);
+#else
+  void* result;
+
+  return posix_memalign(&result, alignment, size) == 0 ? result : NULL;
+#endif
+}
+
+/*!
+ * @brief
+ *   Alignment is raised to at least a pointer since 'posix_memalign' requires it
+ *   and the fallback needs room for the pointer it hides before the allocation.
+ */
+static void* callAlignedAllocator(void* ptr, size_t size, size_t alignment, bfPlatformMemoryTag tag)
+{
+  if (alignment < sizeof(void*))
+  {
+    alignment = sizeof(void*);
+  }
+
+  if (g_BifrostPlatform.aligned_allocator)
+  {
+    void* const result = g_BifrostPlatform.aligned_allocator(ptr, size, alignment, g_BifrostPlatform.user_data);
+
+    if (ptr)
+    {
+      bfMemoryStatsRecord(tag, ptr, size, NULL, 0u);
+    }
+    else
+    {
+      bfMemoryStatsRecord(tag, NULL, 0u, result, size);
+    }
+
+    (void)tag;
+
+    return result;
+  }
+
+  /* NOTE(SR): A custom 'allocator' with no 'aligned_allocator', over allocate from it and keep the real pointer just before the aligned one. */
+  {
+    const size_t padded_size = size + (alignment - 1) + sizeof(void*);
+
+    if (ptr)
+    {
+      (void)callAllocator(((void**)ptr)[-1], padded_size, 0u, tag);
+      return NULL;
+    }
+
+    unsigned char* const base = callAllocator(NULL, 0u, padded_size, tag);
+
+    if (!base)
+    {
+      return NULL;
+    }
+
+    void** const result = (void**)(((uintptr_t)(base + sizeof(void*)) + (alignment - 1)) & ~(uintptr_t)(alignment - 1));
+
+    result[-1] = base;
+
+    return result;
+  }
+}
+
+void* bfPlatformAlloc(size_t size)
+{
+  return callAllocator(NULL, 0u, size, BF_PLATFORM_MEMORY_TAG_GENERAL);
+}
+
+void* bfPlatformRealloc(void* ptr, size_t old_size, size_t new_size)
+{
+  return callAllocator(ptr, old_size, new_size, BF_PLATFORM_MEMORY_TAG_GENERAL);
+}
+
+void bfPlatformFree(void* ptr, size_t old_size)
+{
+  (void)callAllocator(ptr, old_size, 0u, BF_PLATFORM_MEMORY_TAG_GENERAL);
+}
+
+void* bfPlatformAllocAligned(size_t size, size_t alignment)
+{
+  return callAlignedAllocator(NULL, size, alignment, BF_PLATFORM_MEMORY_TAG_GENERAL);
+}
+
+void bfPlatformFreeAligned(void* ptr, size_t size, size_t alignment)
+{
+  if (ptr)
+  {
+    (void)callAlignedAllocator(ptr, size, alignment, BF_PLATFORM_MEMORY_TAG_GENERAL);
+  }
+}
+
+/* Frame Memory */
+
+static unsigned char* bfArenaBlock_data(bfArenaBlock* self)
+{
+  return (unsigned char*)(self + 1);
+}
+
+static size_t bfArenaBlock_alignedOffset(bfArenaBlock* self, size_t offset, size_t alignment)
+{
+  const uintptr_t address = (uintptr_t)(bfArenaBlock_data(self) + offset);
+
+  return offset + (((address + (alignment - 1)) & ~(uintptr_t)(alignment - 1)) - address);
+}
+
+static void* bfArena_alloc(bfArena* self, size_t size, size_t alignment)
+{
+  bfArenaBlock* block = self->current;
+
+  if (block)
+  {
+    const size_t offset = bfArenaBlock_alignedOffset(block, self->current_used, alignment);
+
+    if (offset + size <= block->capacity)
+    {
+      self->current_used = offset + size;
+      return bfArenaBlock_data(block) + offset;
+    }
+
+    block = block->next;
+  }
+  else
+  {
+    block = self->first;
+  }
+
+  /* NOTE(SR): Blocks are kept around after a reset so usually the next one is reused. */
+  if (!block || block->capacity < size + alignment - 1)
+  {
+    const size_t        min_capacity = size + alignment - 1;
+    const size_t        capacity     = min_capacity > BF_PLATFORM_FRAME_BLOCK_SIZE ? min_capacity : BF_PLATFORM_FRAME_BLOCK_SIZE;
+    bfArenaBlock* const new_block    = callAllocator(NULL, 0u, sizeof(bfArenaBlock) + capacity, BF_PLATFORM_MEMORY_TAG_FRAME);
+
+    if (!new_block)
+    {
+      return NULL;
+    }
+
+    new_block->capacity = capacity;
+    new_block->next     = block;
+
+    if (self->current)
+    {
+      self->current->next = new_block;
+    }
+    else
+    {
+      self->first = new_block;
+    }
+
+    block = new_block;
+  }
+
+  const size_t offset = bfArenaBlock_alignedOffset(block, 0u, alignment);
+
+  self->current      = block;
+  self->current_used = offset + size;
+
+  return bfArenaBlock_data(block) + offset;
+}
+
+/*!
+ * @brief
+ *   Grows the most recent allocation in place.
+ *
+ * @return
+ *   0 (false) - `ptr` was not the last allocation or there was no room, nothing was changed.
+ *   1 (true)  - `ptr` now has `size + extra` bytes.
+ */
+static int bfArena_extend(bfArena* self, void* ptr, size_t size, size_t extra)
+{
+  bfArenaBlock* const block = self->current;
+
+  if (block &&
+      (unsigned char*)ptr + size == bfArenaBlock_data(block) + self->current_used &&
+      self->current_used + extra <= block->capacity)
+  {
+    self->current_used += extra;
+    return 1;
+  }
+
+  return 0;
+}
+
+static void bfArena_reset(bfArena* self)
+{
+  self->current      = NULL;
+  self->current_used = 0u;
+}
+
+static void bfArena_destroy(bfArena* self)
+{
+  bfArenaBlock* block = self->first;
+
+  while (block)
+  {
+    bfArenaBlock* const next = block->next;
+
+    (void)callAllocator(block, sizeof(bfArenaBlock) + block->capacity, 0u, BF_PLATFORM_MEMORY_TAG_FRAME);
+    block = next;
+  }
+
+  self->first        = NULL;
+  self->current      = NULL;
+  self->current_used = 0u;
+}
+
+void* bfPlatformFrameAlloc(size_t size, size_t alignment)
+{
+  if (alignment == 0u)
+  {
+    alignment = sizeof(void*);
+  }
+
+  assert((alignment & (alignment - 1u)) == 0u && "Alignment must be a power of two.");
+
+  return bfArena_alloc(&s_FrameArenas[s_FrameArenaIndex], size, alignment);
+}
+
+/* Pool Memory */
+
+typedef struct bfPlatformPoolBlock
+{
+  struct bfPlatformPoolBlock* next;
+
+} bfPlatformPoolBlock;
+
+/* NOTE(SR): Blocks are allocated with the pool's alignment so objects start right after the (padded) header. */
+static size_t bfPlatformPool_headerSize(size_t alignment)
+{
+  return (sizeof(bfPlatformPoolBlock) + (alignment - 1)) & ~(alignment - 1);
+}
+
+static size_t bfPlatformPool_blockSize(const bfPlatformPool* self)
+{
+  return bfPlatformPool_headerSize(self->alignment) + self->objects_per_block * self->object_size;
+}
+
+static int bfPlatformPool_grow(bfPlatformPool* self)
+{
+  bfPlatformPoolBlock* const block = callAlignedAllocator(NULL, bfPlatformPool_blockSize(self), self->alignment, self->tag);
+
+  if (!block)
+  {
+    return 0;
+  }
+
+  unsigned char* const objects = (unsigned char*)block + bfPlatformPool_headerSize(self->alignment);
+  size_t               i       = self->objects_per_block;
+
+  block->next  = self->blocks;
+  self->blocks = block;
+
+  /* NOTE(SR): Threaded back to front so a fresh block is handed out in address order. */
+  while (i--)
+  {
+    void** const object = (void**)(objects + i * self->object_size);
+
+    *object         = self->free_list;
+    self->free_list = object;
+  }
+
+  return 1;
+}
+
+void bfPlatformPool_init(bfPlatformPool* self, size_t object_size, size_t alignment)
+{
+  if (alignment < sizeof(void*))
+  {
+    alignment = sizeof(void*);
+  }
+
+  if (object_size < sizeof(void*))
+  {
+    object_size = sizeof(void*);
+  }
+
+  const size_t header_size = bfPlatformPool_headerSize(alignment);
+
+  object_size = (object_size + (alignment - 1)) & ~(alignment - 1);
+
+  self->blocks            = NULL;
+  self->free_list         = NULL;
+  self->object_size       = object_size;
+  self->alignment         = alignment;
+  self->objects_per_block = header_size + object_size < BF_PLATFORM_POOL_BLOCK_SIZE ?
+                             (BF_PLATFORM_POOL_BLOCK_SIZE - header_size) / object_size :
+                             1u;
+  self->num_allocated     = 0u;
+  self->tag               = BF_PLATFORM_MEMORY_TAG_POOL;
+}
+
+void* bfPlatformPool_alloc(bfPlatformPool* self)
+{
+  if (!self->free_list && !bfPlatformPool_grow(self))
+  {
+    return NULL;
+  }
+
+  void** const object = self->free_list;
+
+  self->free_list = *object;
+  ++self->num_allocated;
+
+  return object;
+}
+
+void bfPlatformPool_free(bfPlatformPool* self, void* ptr)
+{
+  if (ptr)
+  {
+    *(void**)ptr    = self->free_list;
+    self->free_list = ptr;
+    --self->num_allocated;
+  }
+}
+
+void bfPlatformPool_destroy(bfPlatformPool* self)
+{
+  const size_t         block_size = bfPlatformPool_blockSize(self);
+  bfPlatformPoolBlock* block      = self->blocks;
+
+  while (block)
+  {
+    bfPlatformPoolBlock* const next = block->next;
+
+    (void)callAlignedAllocator(block, block_size, self->alignment, self->tag);
+    block = next;
+  }
+
+  self->blocks        = NULL;
+  self->free_list     = NULL;
+  self->num_allocated = 0u;
+}
+
+void bfPlatformShutdownCommon(void)
+{
+  bfArena_destroy(&s_FrameArenas[0]);
+  bfArena_destroy(&s_FrameArenas[1]);
+  bfMemoryStatsReportLeaks();
+}
+
+
+uint64_t bfPlatformTicks(void)
+{
+#if BIFROST_PLATFORM_EMSCRIPTEN
+  return (uint64_t)(emscripten_get_now() * 1000000.0);
+#elif BIFROST_PLATFORM_WINDOWS
+  LARGE_INTEGER counter;
+  QueryPerformanceCounter(&counter);
+
+  return (uint64_t)counter.QuadPart;
+#else
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+
+  return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+#endif
+}
+
+uint64_t bfPlatformTickFrequency(void)
+{
+#if BIFROST_PLATFORM_WINDOWS
+  static LARGE_INTEGER s_Frequency = {0};
+
+  if (!s_Frequency.QuadPart)
+  {
+    QueryPerformanceFrequency(&s_Frequency);
+  }
+
+  return (uint64_t)s_Frequency.QuadPart;
+#else
+  return 1000000000u;
+#endif
+}
+
+static uint64_t ticksToNs(uint64_t ticks)
+{
+#if BIFROST_PLATFORM_WINDOWS
+  const uint64_t frequency = bfPlatformTickFrequency();
+
+  /* NOTE(SR): Split into whole seconds and remainder so the multiply does not overflow. */
+  return ticks / frequency * 1000000000u + ticks % frequency * 1000000000u / frequency;
+#else
+  return ticks;
+#endif
+}
+
+uint64_t bfPlatformTimeNowNs(void)
+{
+  return ticksToNs(bfPlatformTicks());
+}
+
+/*
+  NOTE(SR):
+    The OS is asked to wake us up 's_SleepSpinTime' early and the rest is spun
+    out. How late each wake up actually was feeds back into the margin, it
+    grows right away to cover a late wake up and shrinks slowly afterwards so
+    one lucky wake up does not cause the next deadline to be missed.
+    Racing threads can only lose an update which is harmless.
+*/
+
+static size_t s_SleepSpinTime = BF_PLATFORM_SLEEP_SPIN_TIME;
+
+static void sleepOS(uint64_t wake_time, uint64_t now)
+{
+#if BIFROST_PLATFORM_EMSCRIPTEN
+  /* NOTE(SR): Blocking the browser's main thread is not allowed, only the spin is left. */
+  (void)wake_time;
+  (void)now;
+#elif BIFROST_PLATFORM_WINDOWS
+  const uint64_t duration = wake_time - now;
+
+  /* NOTE(SR): 'Sleep' only has the system timer's (~15ms) resolution, the high resolution timer is Windows 10 1803+. */
+  HANDLE timer = CreateWaitableTimerExW(NULL, NULL, 0x00000002 /* CREATE_WAITABLE_TIMER_HIGH_RESOLUTION */, TIMER_ALL_ACCESS);
+
+  if (timer)
+  {
+    LARGE_INTEGER due_time;
+    due_time.QuadPart = -(LONGLONG)(duration / 100u); /* Negative is relative, in 100ns units. */
+
+    if (SetWaitableTimer(timer, &due_time, 0, NULL, NULL, FALSE))
+    {
+      WaitForSingleObject(timer, INFINITE);
+    }
+
+    CloseHandle(timer);
+  }
+  else
+  {
+    Sleep((DWORD)(duration / 1000000u));
+  }
+#elif BIFROST_PLATFORM_MACOS || BIFROST_PLATFORM_IOS
+  /* NOTE(SR): No 'clock_nanosleep' on Apple platforms. */
+  const uint64_t  duration = wake_time - now;
+  struct timespec request;
+
+  request.tv_sec  = (time_t)(duration / 1000000000u);
+  request.tv_nsec = (long)(duration % 1000000000u);
+
+  nanosleep(&request, NULL);
+#else
+  struct timespec request;
+
+  request.tv_sec  = (time_t)(wake_time / 1000000000u);
+  request.tv_nsec = (long)(wake_time % 1000000000u);
+
+  (void)now;
+
+  /* NOTE(SR): Absolute so being interrupted by a signal just means sleeping again for the remainder. */
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &request, NULL) == EINTR)
+  {
+  }
+#endif
+}
+
+void bfPlatformSleepUntil(uint64_t deadline_ns)
+{
+  const uint64_t spin_time = bfAtomicLoadAcquire(&s_SleepSpinTime);
+  uint64_t       now       = bfPlatformTimeNowNs();
+
+  if (deadline_ns > now + spin_time)
+  {
+    const uint64_t wake_time = deadline_ns - spin_time;
+    uint64_t       lateness;
+    uint64_t       margin;
+
+    sleepOS(wake_time, now);
+
+    now      = bfPlatformTimeNowNs();
+    lateness = now > wake_time ? now - wake_time : 0u;
+    margin   = lateness + lateness / 2u;
+    margin   = margin > spin_time ? margin : spin_time - (spin_time - margin) / 16u;
+    margin   = margin < BF_PLATFORM_SLEEP_SPIN_MIN ? BF_PLATFORM_SLEEP_SPIN_MIN : margin > BF_PLATFORM_SLEEP_SPIN_MAX ? BF_PLATFORM_SLEEP_SPIN_MAX : margin;
+
+    bfAtomicStoreRelease(&s_SleepSpinTime, (size_t)margin);
+  }
+
+  while (now < deadline_ns)
+  {
+    now = bfPlatformTimeNowNs();
+  }
+}
+
+static uint64_t loopPeriod(void)
+{
+  const uint32_t rate = g_BifrostPlatform.target_fps ? g_BifrostPlatform.target_fps : k_bfPlatformDefaultTargetFPS;
+
+  return 1000000000u / rate;
+}
+
+/* NOTE(SR): Minimum time between frames, 0 for no limit. */
+static uint64_t pacingPeriod(void)
+{
+  uint64_t period = g_BifrostPlatform.loop_mode == BF_PLATFORM_LOOP_TARGET_FPS ? loopPeriod() : 0u;
+
+  if (s_NumFocusedWindows == 0u && g_BifrostPlatform.background_fps)
+  {
+    const uint64_t background_period = 1000000000u / g_BifrostPlatform.background_fps;
+
+    period = background_period > period ? background_period : period;
+  }
+
+  return period;
+}
+
+/* NOTE(SR): Called before pumping events so the frame is drawn with the freshest input. */
+static void paceFrame(void)
+{
+#if !BIFROST_PLATFORM_EMSCRIPTEN /* NOTE(SR): The browser is given the rate in 'emscripten_set_main_loop_arg' and throttles background tabs itself. */
+  const uint64_t period = pacingPeriod();
+
+  if (period)
+  {
+    /* NOTE(SR): Deadline is from the current period so regaining focus takes effect on the very next frame. */
+    const uint64_t deadline = s_LoopLastFrameTime + period;
+    uint64_t       now      = bfPlatformTimeNowNs();
+
+    if (deadline > now)
+    {
+      bfProfileZoneBegin("bfPlatformSleepUntil");
+      bfPlatformSleepUntil(deadline);
+      bfProfileZoneEnd();
+      now = bfPlatformTimeNowNs();
+    }
+
+    /* NOTE(SR): Kept on the ideal schedule so waking up late does not drift the rate, unless a whole frame was missed. */
+    s_LoopLastFrameTime = now - deadline < period ? deadline : now;
+  }
+#endif
+}
+
+static void runFixedSteps(bfWindow* main_window)
+{
+  const uint64_t step = loopPeriod();
+  const uint64_t now  = bfPlatformTimeNowNs();
+
+  s_LoopStepAccumulator += s_LoopLastStepTime ? now - s_LoopLastStepTime : 0u;
+  s_LoopLastStepTime = now;
+
+  if (s_LoopStepAccumulator > step * BF_PLATFORM_MAX_FIXED_STEPS)
+  {
+    s_LoopStepAccumulator = step * BF_PLATFORM_MAX_FIXED_STEPS;
+  }
+
+  while (s_LoopStepAccumulator >= step)
+  {
+    if (main_window->update_fn)
+    {
+      bfProfileZoneBegin("bfWindow::update_fn");
+      main_window->update_fn(main_window, (float)((double)step / 1000000000.0));
+      bfProfileZoneEnd();
+    }
+
+    s_LoopStepAccumulator -= step;
+  }
+
+  s_LoopFrameAlpha = (float)((double)s_LoopStepAccumulator / (double)step);
+}
+
+float bfPlatformFrameAlpha(void)
+{
+  return s_LoopFrameAlpha;
+}
+
+/*
+  NOTE(SR):
+    'marks' holds the tick count at the start of the frame followed by the end
+    of each phase in 'bfPlatformFramePhase' order, with 'BF_PLATFORM_FRAME_STATS'
+    off these macros leave nothing behind, not even the array.
+*/
+
+#if BF_PLATFORM_FRAME_STATS
+#define bfFrameStatsDeclare(marks)     uint64_t marks[BF_PLATFORM_FRAME_PHASE_TOTAL + 1]
+#define bfFrameStatsBegin(marks)       marks[0] = bfPlatformTicks()
+#define bfFrameStatsEnd(marks, phase)  marks[(phase) + 1] = bfPlatformTicks()
+#define bfFrameStatsRecord(marks)      recordFrameStats(marks)
+
+static uint64_t s_FrameStatsTicks[BF_PLATFORM_FRAME_PHASE_MAX][BF_PLATFORM_FRAME_STATS_HISTORY];
+static uint32_t s_FrameStatsCount = 0u; /*!< Total frames recorded, the ring is indexed by this modulo the history size. */
+
+static void recordFrameStats(const uint64_t marks[BF_PLATFORM_FRAME_PHASE_TOTAL + 1])
+{
+  const uint32_t slot = s_FrameStatsCount++ % BF_PLATFORM_FRAME_STATS_HISTORY;
+  int            phase;
+
+  for (phase = 0; phase < BF_PLATFORM_FRAME_PHASE_TOTAL; ++phase)
+  {
+    s_FrameStatsTicks[phase][slot] = marks[phase + 1] - marks[phase];
+  }
+
+  s_FrameStatsTicks[BF_PLATFORM_FRAME_PHASE_TOTAL][slot] = marks[BF_PLATFORM_FRAME_PHASE_TOTAL] - marks[0];
+}
+
+static int compareTicks(const void* lhs, const void* rhs)
+{
+  const uint64_t a = *(const uint64_t*)lhs;
+  const uint64_t b = *(const uint64_t*)rhs;
+
+  return (a > b) - (a < b);
+}
+
+/* NOTE(SR): Nearest rank, `sorted` must have at least one element. */
+static uint64_t percentile(const uint64_t* sorted, uint32_t count, uint32_t percent)
+{
+  const uint32_t rank = (percent * count + 99u) / 100u;
+
+  return sorted[rank ? rank - 1u : 0u];
+}
+#else
+#define bfFrameStatsDeclare(marks)
+#define bfFrameStatsBegin(marks)
+#define bfFrameStatsEnd(marks, phase)
+#define bfFrameStatsRecord(marks)
+#endif
+
+Boolean bfPlatformGetFrameStats(bfPlatformFrameStats* out)
+{
+  memset(out, 0x0, sizeof(*out));
+
+#if BF_PLATFORM_FRAME_STATS
+  {
+    const uint32_t count = s_FrameStatsCount < BF_PLATFORM_FRAME_STATS_HISTORY ? s_FrameStatsCount : BF_PLATFORM_FRAME_STATS_HISTORY;
+    uint64_t       sorted[BF_PLATFORM_FRAME_STATS_HISTORY];
+    int            phase;
+
+    out->num_frames = count;
+
+    if (count == 0u)
+    {
+      return 1;
+    }
+
+    for (phase = 0; phase < BF_PLATFORM_FRAME_PHASE_MAX; ++phase)
+    {
+      bfPlatformDurationStats* const stats = &out->phases[phase];
+      uint64_t                       sum   = 0u;
+      uint32_t                       i;
+
+      memcpy(sorted, s_FrameStatsTicks[phase], sizeof(uint64_t) * count);
+      qsort(sorted, count, sizeof(uint64_t), &compareTicks);
+
+      for (i = 0; i < count; ++i)
+      {
+        sum += sorted[i];
+      }
+
+      stats->min = ticksToNs(sorted[0]);
+      stats->avg = ticksToNs(sum / count);
+      stats->p50 = ticksToNs(percentile(sorted, count, 50u));
+      stats->p95 = ticksToNs(percentile(sorted, count, 95u));
+      stats->p99 = ticksToNs(percentile(sorted, count, 99u));
+      stats->max = ticksToNs(sorted[count - 1u]);
+    }
+  }
+
+  return 1;
+#else
+  return 0;
+#endif
+}
+
+#define k_bfNoWindowFrame ((uint64_t)-1)
+
+static int isWindowDrawable(const BifrostWindowBase* window)
+{
+  return window->super.frame_fn &&
+         !window->is_minimized &&
+         !window->is_hidden &&
+         (g_BifrostPlatform.redraw_mode != BF_PLATFORM_REDRAW_ON_DEMAND || window->is_dirty);
+}
+
+/* NOTE(SR): True when there are windows but none of them can be seen. */
+static int areAllWindowsMinimized(void)
+{
+  int has_window = 0;
+  int i;
+
+  for (i = 0; i < BF_PLATFORM_MAX_WINDOWS; ++i)
+  {
+    const BifrostWindowBase* const window = s_Windows[i];
+
+    if (window)
+    {
+      if (!window->is_minimized && !window->is_hidden)
+      {
+        return 0;
+      }
+
+      has_window = 1;
+    }
+  }
+
+  return has_window;
+}
+
+/* NOTE(SR): Earliest time any window wants to be drawn, 'k_bfNoWindowFrame' if none do. */
+static uint64_t nextWindowFrameTime(void)
+{
+  uint64_t result = k_bfNoWindowFrame;
+  int      i;
+
+  for (i = 0; i < BF_PLATFORM_MAX_WINDOWS; ++i)
+  {
+    const BifrostWindowBase* const window = s_Windows[i];
+
+    if (window && isWindowDrawable(window) && window->next_frame_time < result)
+    {
+      result = window->next_frame_time;
+    }
+  }
+
+  return result;
+}
+
+/*
+  NOTE(SR):
+    When the next 'bfWindow::update_fn' step is due, 'k_bfNoWindowFrame' if there are no steps to run.
+    Steps keep going while nothing is drawn so the simulation does not freeze when minimized.
+*/
+static uint64_t nextStepTime(const bfWindow* main_window)
+{
+  if (g_BifrostPlatform.loop_mode != BF_PLATFORM_LOOP_FIXED_TIMESTEP || !main_window->update_fn)
+  {
+    return k_bfNoWindowFrame;
+  }
+
+  return s_LoopLastStepTime ? s_LoopLastStepTime + (loopPeriod() - s_LoopStepAccumulator) : 0u;
+}
+
+static void drawWindow(BifrostWindowBase* window, uint64_t now)
+{
+  bfWindow* const self = &window->super;
+
+  if (window->frame_period)
+  {
+    /* NOTE(SR): Same as 'paceFrame', scheduled off the last deadline so the rate does not drift. */
+    const uint64_t next_frame_time = window->next_frame_time + window->frame_period;
+
+    window->next_frame_time = next_frame_time > now ? next_frame_time : now + window->frame_period;
+  }
+
+  /* NOTE(SR): Cleared before the frame so 'frame_fn' can ask for another one. */
+  window->is_dirty = 0;
+
+  bfProfileZoneBegin("bfWindow::frame_fn");
+  self->frame_fn(self);
+  bfProfileZoneEnd();
+}
+
+static void bfPlatformDoMainLoopImpl(void* arg)
+{
+  bfWindow* const main_window = (bfWindow*)arg;
+  uint64_t        now;
+  int             i;
+  bfFrameStatsDeclare(marks);
+
+  bfFrameStatsBegin(marks);
+
+#if BIFROST_PLATFORM_EMSCRIPTEN
+  /* NOTE(SR): The browser owns the loop so blocking is not an option, skipping the frame is still a win. */
+  bfFrameStatsEnd(marks, BF_PLATFORM_FRAME_PHASE_WAIT);
+  bfPlatformPumpEvents();
+#else
+  {
+    const uint64_t next_frame_time = nextWindowFrameTime();
+    const uint64_t next_step_time  = nextStepTime(main_window);
+    const int      is_idle         = next_frame_time == k_bfNoWindowFrame &&
+                            (g_BifrostPlatform.redraw_mode == BF_PLATFORM_REDRAW_ON_DEMAND || areAllWindowsMinimized());
+
+    now = bfPlatformTimeNowNs();
+
+    if (next_frame_time <= now || (next_frame_time == k_bfNoWindowFrame && !is_idle))
+    {
+      paceFrame();
+      bfFrameStatsEnd(marks, BF_PLATFORM_FRAME_PHASE_WAIT);
+      bfPlatformPumpEvents();
+    }
+    else
+    {
+      /* NOTE(SR): Nothing to draw yet (or everything is minimized), sleep until something is due or an event wakes us up. */
+      const uint64_t wake_time = next_step_time < next_frame_time ? next_step_time : next_frame_time;
+
+      if (wake_time == k_bfNoWindowFrame)
+      {
+        bfPlatformWaitEvents();
+      }
+      else if (wake_time > now)
+      {
+        bfPlatformWaitEventsTimeout(wake_time - now);
+      }
+      else
+      {
+        bfPlatformPumpEvents();
+      }
+
+      /* NOTE(SR): Still paced so a flood of input events can not go over the target rate. */
+      if (nextWindowFrameTime() <= bfPlatformTimeNowNs())
+      {
+        paceFrame();
+      }
+
+      bfFrameStatsEnd(marks, BF_PLATFORM_FRAME_PHASE_WAIT);
+    }
+  }
+#endif
+
+  bfFrameStatsEnd(marks, BF_PLATFORM_FRAME_PHASE_EVENTS);
+
+  if (g_BifrostPlatform.loop_mode == BF_PLATFORM_LOOP_FIXED_TIMESTEP)
+  {
+    runFixedSteps(main_window);
+  }
+
+  bfFrameStatsEnd(marks, BF_PLATFORM_FRAME_PHASE_UPDATE);
+
+  now = bfPlatformTimeNowNs();
+
+  /* NOTE(SR): Only the drawing waits on the windows, a loop that drew nothing is not counted as a frame. */
+  if (nextWindowFrameTime() > now)
+  {
+    return;
+  }
+
+  /* NOTE(SR): Read from the registry each time since a 'frame_fn' is allowed to create and destroy windows. */
+  for (i = 0; i < BF_PLATFORM_MAX_WINDOWS; ++i)
+  {
+    BifrostWindowBase* const window = s_Windows[i];
+
+    if (window && isWindowDrawable(window) && window->next_frame_time <= now)
+    {
+      drawWindow(window, now);
+    }
+  }
+
+  bfFrameStatsEnd(marks, BF_PLATFORM_FRAME_PHASE_RENDER);
+  bfFrameStatsRecord(marks);
+
+#if BIFROST_PLATFORM_EMSCRIPTEN
+  // Needed only if " ctx_attribs.explicitSwapControl" is true.
+  // emscripten_webgl_commit_frame();
+  // emscripten_cancel_main_loop();
+#endif
+}
+
+void bfPlatformDoMainLoop(bfWindow* main_window)
+{
+#if BIFROST_PLATFORM_EMSCRIPTEN
+  const uint32_t target_fps = g_BifrostPlatform.target_fps ? g_BifrostPlatform.target_fps : k_bfPlatformDefaultTargetFPS;
+  const int      fps        = g_BifrostPlatform.loop_mode == BF_PLATFORM_LOOP_TARGET_FPS ? (int)target_fps : 0 /* requestAnimationFrame */;
+
+  emscripten_set_main_loop_arg(&bfPlatformDoMainLoopImpl, main_window, fps, 1);
+#else
+  while (!bfWindow_wantsToClose(main_window))
+  {
+    bfPlatformDoMainLoopImpl(main_window);
+  }
+#endif
+}
+
+/* Events */
+
+static void deliverEvent(bfWindow* window, bfEvent* event)
+{
+  event->receiver = window;
+
+  windowBaseCast(window)->is_dirty = 1;
+
+  if (g_BifrostPlatform.event_mode == BF_PLATFORM_EVENT_MODE_QUEUED)
+  {
+    bfEventQueue* const queue = &s_EventQueue;
+
+    /*
+      NOTE(SR):
+        If the application is not draining the queue fast enough the newest
+        events are dropped rather than overwriting ones not read yet.
+    */
+    const size_t tail = queue->tail;
+
+    if (tail - bfAtomicLoadAcquire(&queue->head) < BF_PLATFORM_EVENT_QUEUE_SIZE)
+    {
+      queue->events[tail & (BF_PLATFORM_EVENT_QUEUE_SIZE - 1)] = *event;
+      bfAtomicStoreRelease(&queue->tail, tail + 1);
+    }
+  }
+  else if (window->event_fn)
+  {
+    bfProfileZoneBegin("bfWindow::event_fn");
+    window->event_fn(window, event);
+    bfProfileZoneEnd();
+  }
+}
+
+static void markPending(BifrostWindowBase* window, uint8_t pending_flag)
+{
+  if (!window->pending_flags)
+  {
+    window->next_pending = s_PendingWindows;
+    s_PendingWindows     = window;
+  }
+
+  window->pending_flags |= pending_flag;
+}
+
+static void flushPendingEvents(void)
+{
+  while (s_PendingWindows)
+  {
+    BifrostWindowBase* const window        = s_PendingWindows;
+    const uint8_t            pending_flags = window->pending_flags;
+
+    s_PendingWindows      = window->next_pending;
+    window->next_pending  = NULL;
+    window->pending_flags = 0x0;
+
+    if (pending_flags & k_bfWindowPendingMouseMove)
+    {
+      deliverEvent(&window->super, &window->pending_move);
+    }
+
+    if (pending_flags & k_bfWindowPendingMouseMotion)
+    {
+      deliverEvent(&window->super, &window->pending_motion);
+    }
+
+    if (pending_flags & k_bfWindowPendingScrollWheel)
+    {
+      deliverEvent(&window->super, &window->pending_scroll);
+    }
+
+    if (pending_flags & k_bfWindowPendingText)
+    {
+      deliverEvent(&window->super, &window->pending_text);
+    }
+  }
+}
+
+static void updateInputState(BifrostWindowBase* window, const bfEvent* event)
+{
+  bfInputState* const state = &window->input_state[window->input_current];
+
+  switch (event->type)
+  {
+    case BIFROST_EVT_ON_KEY_DOWN:
+    case BIFROST_EVT_ON_KEY_UP:
+    {
+      const int key = event->keyboard.key;
+
+      if (key >= 0 && key < k_bfInputStateMaxKeys)
+      {
+        const uint64_t bit = (uint64_t)1u << (key & 63);
+
+        if (event->type == BIFROST_EVT_ON_KEY_DOWN)
+        {
+          state->keys[key >> 6] |= bit;
+        }
+        else
+        {
+          state->keys[key >> 6] &= ~bit;
+        }
+      }
+      break;
+    }
+    case BIFROST_EVT_ON_MOUSE_DOWN:
+    case BIFROST_EVT_ON_MOUSE_MOVE:
+    case BIFROST_EVT_ON_MOUSE_UP:
+    {
+      state->mouse_x = event->mouse.x;
+      state->mouse_y = event->mouse.y;
+      state->buttons = event->mouse.button_state;
+      break;
+    }
+    case BIFROST_EVT_ON_MOUSE_MOTION:
+    {
+      state->mouse_x = (int)event->mouse_motion.x;
+      state->mouse_y = (int)event->mouse_motion.y;
+      state->mouse_delta_x += event->mouse_motion.delta_x;
+      state->mouse_delta_y += event->mouse_motion.delta_y;
+      break;
+    }
+    case BIFROST_EVT_ON_SCROLL_WHEEL:
+    {
+      state->scroll_x += event->scroll_wheel.x;
+      state->scroll_y += event->scroll_wheel.y;
+      break;
+    }
+    default:
+    {
+      break;
+    }
+  }
+}
+
+int BifrostWindowBase_init(BifrostWindowBase* self)
+{
+  uint16_t index;
+
+  for (index = 0; index < BF_PLATFORM_MAX_WINDOWS; ++index)
+  {
+    if (!s_Windows[index])
+    {
+      s_Windows[index]         = self;
+      self->index              = index;
+      self->event_mask         = k_bfEventMaskDefault;
+      self->coalesce_flags     = k_bfWindowCoalesceNone;
+      self->pending_flags      = 0x0;
+      self->next_pending       = NULL;
+      self->input_current      = 0;
+      self->is_dirty           = 1;
+      self->is_cursor_captured = 0;
+      self->is_minimized       = 0;
+      self->is_hidden          = 0;
+      self->is_focused         = 0;
+      self->frame_period       = 0u;
+      self->next_frame_time    = 0u;
+
+      memset(self->input_state, 0x0, sizeof(self->input_state));
+
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+void BifrostWindowBase_shutdown(BifrostWindowBase* self)
+{
+  s_Windows[self->index] = NULL;
+
+  if (g_BifrostPlatform.event_mode == BF_PLATFORM_EVENT_MODE_QUEUED)
+  {
+    bfEventQueue* const queue = &s_EventQueue;
+    const size_t        tail  = queue->tail;
+    size_t              i;
+
+    /* NOTE(SR): Events not polled yet would otherwise hand out a pointer to the freed window. */
+    for (i = bfAtomicLoadAcquire(&queue->head); i != tail; ++i)
+    {
+      bfEvent* const event = &queue->events[i & (BF_PLATFORM_EVENT_QUEUE_SIZE - 1)];
+
+      if (event->receiver == &self->super)
+      {
+        event->receiver = NULL;
+      }
+    }
+  }
+
+  BifrostWindowBase_setFocused(self, 0);
+
+  if (self->pending_flags)
+  {
+    BifrostWindowBase** link = &s_PendingWindows;
+
+    while (*link != self)
+    {
+      link = &(*link)->next_pending;
+    }
+
+    *link               = self->next_pending;
+    self->pending_flags = 0x0;
+  }
+}
+
+uint16_t bfWindow_index(bfWindow* self)
+{
+  return windowBaseCast(self)->index;
+}
+
+bfWindow* bfPlatformFirstWindow(void)
+{
+  uint16_t i;
+
+  for (i = 0; i < BF_PLATFORM_MAX_WINDOWS; ++i)
+  {
+    if (s_Windows[i])
+    {
+      return &s_Windows[i]->super;
+    }
+  }
+
+  return NULL;
+}
+
+bfWindow* bfPlatformWindowFromIndex(uint16_t index)
+{
+  return index < BF_PLATFORM_MAX_WINDOWS && s_Windows[index] ? &s_Windows[index]->super : NULL;
+}
+
+uint32_t bfWindow_eventMask(bfWindow* self)
+{
+  return windowBaseCast(self)->event_mask;
+}
+
+void bfWindow_setEventCoalescing(bfWindow* self, uint32_t flags)
+{
+  windowBaseCast(self)->coalesce_flags = (uint8_t)(flags & k_bfWindowCoalesceAll);
+}
+
+int bfWindow_isCursorCaptured(bfWindow* self)
+{
+  return windowBaseCast(self)->is_cursor_captured;
+}
+
+void bfWindow_markDirty(bfWindow* self)
+{
+  windowBaseCast(self)->is_dirty = 1;
+}
+
+void bfWindow_setFrameRate(bfWindow* self, uint32_t fps)
+{
+  BifrostWindowBase* const window = windowBaseCast(self);
+
+  window->frame_period    = fps ? 1000000000u / fps : 0u;
+  window->next_frame_time = 0u;
+}
+
+void BifrostWindowBase_setFocused(BifrostWindowBase* self, int is_focused)
+{
+  is_focused = is_focused != 0;
+
+  if (self->is_focused != is_focused)
+  {
+    self->is_focused = (uint8_t)is_focused;
+
+    if (is_focused)
+    {
+      ++s_NumFocusedWindows;
+    }
+    else
+    {
+      --s_NumFocusedWindows;
+    }
+  }
+}
 
-#include "bf/platform/bf_platform_event.h"
+static void updateWindowState(BifrostWindowBase* window, const bfEvent* event)
+{
+  if (event->type == BIFROST_EVT_ON_WINDOW_MINIMIZE)
+  {
+    window->is_minimized = (event->window.state & BIFROST_WINDOW_IS_MINIMIZED) != 0;
+  }
+  else if (event->type == BIFROST_EVT_ON_WINDOW_FOCUS_CHANGED)
+  {
+    BifrostWindowBase_setFocused(window, event->window.state & BIFROST_WINDOW_IS_FOCUSED);
+  }
+}
 
-#if BIFROST_PLATFORM_EMSCRIPTEN
-#include <emscripten.h>
-#endif
+void bfPlatformDispatchEvent(bfWindow* window, bfEvent event)
+{
+  BifrostWindowBase* const window_base = windowBaseCast(window);
 
-#include <stdlib.h> /* realloc */
-#include <string.h> /* memcpy  */
+  updateInputState(window_base, &event);
+  updateWindowState(window_base, &event);
 
-bfPlatformInitParams g_BifrostPlatform;
+  if (!BifrostWindowBase_wantsEvent(window_base, event.type))
+  {
+    return;
+  }
 
-bfPlatformGfxAPI bfPlatformGetGfxAPI(void)
-{
-#if defined(BF_PLATFORM_USE_VULKAN)
-  return BIFROST_PLATFORM_GFX_VUlKAN;
-#elif defined(BF_PLATFORM_USE_OPENGL)
-  return BIFROST_PLATFORM_GFX_OPENGL;
-#else
-#error "One of these should be defined"
-#endif
+  if (event.type == BIFROST_EVT_ON_MOUSE_MOVE && (window_base->coalesce_flags & k_bfWindowCoalesceMouseMove))
+  {
+    /* The latest move already has the final position and button state. */
+    window_base->pending_move = event;
+    markPending(window_base, k_bfWindowPendingMouseMove);
+    return;
+  }
+
+  if (event.type == BIFROST_EVT_ON_MOUSE_MOTION && (window_base->coalesce_flags & k_bfWindowCoalesceMouseMove))
+  {
+    if (window_base->pending_flags & k_bfWindowPendingMouseMotion)
+    {
+      window_base->pending_motion.mouse_motion.x = event.mouse_motion.x;
+      window_base->pending_motion.mouse_motion.y = event.mouse_motion.y;
+      window_base->pending_motion.mouse_motion.delta_x += event.mouse_motion.delta_x;
+      window_base->pending_motion.mouse_motion.delta_y += event.mouse_motion.delta_y;
+
+      window_base->pending_motion.timestamp = event.timestamp;
+    }
+    else
+    {
+      window_base->pending_motion = event;
+      markPending(window_base, k_bfWindowPendingMouseMotion);
+    }
+
+    return;
+  }
+
+  if (event.type == BIFROST_EVT_ON_SCROLL_WHEEL && (window_base->coalesce_flags & k_bfWindowCoalesceScrollWheel))
+  {
+    if (window_base->pending_flags & k_bfWindowPendingScrollWheel)
+    {
+      window_base->pending_scroll.scroll_wheel.x += event.scroll_wheel.x;
+      window_base->pending_scroll.scroll_wheel.y += event.scroll_wheel.y;
+
+      window_base->pending_scroll.timestamp = event.timestamp;
+    }
+    else
+    {
+      window_base->pending_scroll = event;
+      markPending(window_base, k_bfWindowPendingScrollWheel);
+    }
+
+    return;
+  }
+
+  /*
+    NOTE(SR):
+      Anything held back must go out first to keep the order
+      of coalesced events relative to every other event intact.
+  */
+  flushPendingEvents();
+  deliverEvent(window, &event);
 }
 
-void* bfPlatformDefaultAllocator(void* ptr, size_t old_size, size_t new_size, void* user_data)
+void bfPlatformDispatchText(bfWindow* window, const char* utf8, size_t length, uint64_t timestamp)
 {
-  (void)user_data;
-  (void)old_size;
+  BifrostWindowBase* const window_base = windowBaseCast(window);
+  bfArena* const           arena       = &s_FrameArenas[s_FrameArenaIndex];
+
+  if (!length || !BifrostWindowBase_wantsEvent(window_base, BIFROST_EVT_ON_TEXT_INPUT))
+  {
+    return;
+  }
 
   /*
-    NOTE(Shareef):
-      "if new_size is zero, the behavior is implementation defined
-      (null pointer may be returned in which case the old memory block may or may not be freed),
-      or some non-null pointer may be returned that may
-      not be used to access storage."
+    NOTE(SR):
+      Text is always kept NUL terminated, when this window's text was the
+      last thing allocated it is grown in place otherwise it is copied.
   */
-  if (new_size == 0u)
+  if (window_base->pending_flags & k_bfWindowPendingText)
   {
-    free(ptr);
-    ptr = NULL;
+    bfTextInputEvent* const text     = &window_base->pending_text.text_input;
+    char*                   old_text = (char*)text->text;
+
+    if (!bfArena_extend(arena, old_text, text->length + 1u, length))
+    {
+      char* const new_text = bfArena_alloc(arena, text->length + length + 1u, 1u);
+
+      if (!new_text)
+      {
+        return;
+      }
+
+      memcpy(new_text, old_text, text->length);
+      text->text = new_text;
+      old_text   = new_text;
+    }
+
+    memcpy(old_text + text->length, utf8, length);
+    text->length += length;
+    old_text[text->length] = '\0';
+
+    window_base->pending_text.timestamp = timestamp;
   }
   else
   {
-    void* const new_ptr = realloc(ptr, new_size);
+    char* const new_text = bfArena_alloc(arena, length + 1u, 1u);
 
-    if (!new_ptr)
+    if (!new_text)
     {
-      /*
-        NOTE(Shareef):
-          As to not leak memory, realloc says:
-            "If there is not enough memory,
-            the old memory block is not freed and null pointer is returned."
-      */
-      free(ptr);
+      return;
     }
 
-    ptr = new_ptr;
+    memcpy(new_text, utf8, length);
+    new_text[length] = '\0';
+
+    bfTextInputEvent evt_data = bfTextInputEvent_make(new_text, length);
+
+    window_base->pending_text           = bfEvent_make(BIFROST_EVT_ON_TEXT_INPUT, 0x0, evt_data);
+    window_base->pending_text.timestamp = timestamp;
+    markPending(window_base, k_bfWindowPendingText);
   }
+}
 
-  return ptr;
+int bfPlatformRunOnMainThread(bfPlatformMainThreadFn fn, void* user_data)
+{
+  bfCommandQueue* const queue = &s_CommandQueue;
+  const size_t          tail  = queue->tail;
+
+  if (tail - bfAtomicLoadAcquire(&queue->head) < BF_PLATFORM_COMMAND_QUEUE_SIZE)
+  {
+    bfPlatformCommand* const command = &queue->commands[tail & (BF_PLATFORM_COMMAND_QUEUE_SIZE - 1)];
+
+    command->fn        = fn;
+    command->user_data = user_data;
+
+    bfAtomicStoreRelease(&queue->tail, tail + 1);
+    bfPlatformWakeUp();
+
+    return 1;
+  }
+
+  return 0;
 }
 
-void* bfPlatformAlloc(size_t size)
+static void runMainThreadCommands(void)
+{
+  bfCommandQueue* const queue = &s_CommandQueue;
+  const size_t          tail  = bfAtomicLoadAcquire(&queue->tail);
+  size_t                head  = queue->head;
+
+  /*
+    NOTE(SR):
+      Only runs what was queued before the drain started so a
+      command that queues another one can not starve the pump.
+  */
+  while (head != tail)
+  {
+    const bfPlatformCommand command = queue->commands[head & (BF_PLATFORM_COMMAND_QUEUE_SIZE - 1)];
+
+    bfAtomicStoreRelease(&queue->head, ++head);
+    bfProfileZoneBegin("bfPlatformRunOnMainThread");
+    command.fn(command.user_data);
+    bfProfileZoneEnd();
+  }
+}
+
+void bfPlatformBeginPumpEvents(void)
+{
+  uint16_t i;
+
+  /*
+    NOTE(SR):
+      Two arenas so text from the last pump is still readable while this one runs.
+      A queued consumer can lag any number of pumps behind so the arena is only
+      reset once a poll has released every event written while it was current,
+      until then it keeps growing.
+  */
+  s_FrameArenaTails[s_FrameArenaIndex] = s_EventQueue.tail;
+  s_FrameArenaIndex ^= 1u;
+
+  if (g_BifrostPlatform.event_mode != BF_PLATFORM_EVENT_MODE_QUEUED ||
+      bfAtomicLoadAcquire(&s_EventQueue.released) >= s_FrameArenaTails[s_FrameArenaIndex])
+  {
+    bfArena_reset(&s_FrameArenas[s_FrameArenaIndex]);
+  }
+  bfMemoryStatsEndFrame();
+
+  for (i = 0; i < BF_PLATFORM_MAX_WINDOWS; ++i)
+  {
+    BifrostWindowBase* const window = s_Windows[i];
+
+    if (window)
+    {
+      const uint8_t       next_index = window->input_current ^ 1u;
+      bfInputState* const next_state = &window->input_state[next_index];
+
+      *next_state               = window->input_state[window->input_current];
+      next_state->scroll_x      = 0.0;
+      next_state->scroll_y      = 0.0;
+      next_state->mouse_delta_x = 0.0f;
+      next_state->mouse_delta_y = 0.0f;
+      window->input_current     = next_index;
+    }
+  }
+}
+
+void bfPlatformEndPumpEvents(void)
 {
-  return g_BifrostPlatform.allocator(NULL, 0u, size, g_BifrostPlatform.user_data);
+  bfProfileZoneBegin("bfPlatformUpdateGamepads");
+  bfPlatformUpdateGamepads();
+  bfProfileZoneEnd();
+  flushPendingEvents();
+  runMainThreadCommands();
 }
 
-void* bfPlatformRealloc(void* ptr, size_t old_size, size_t new_size)
+const bfInputState* bfWindow_inputState(bfWindow* self)
 {
-  return g_BifrostPlatform.allocator(ptr, old_size, new_size, g_BifrostPlatform.user_data);
+  const BifrostWindowBase* const window = windowBaseCast(self);
+
+  return &window->input_state[window->input_current];
 }
 
-void bfPlatformFree(void* ptr, size_t old_size)
+const bfInputState* bfWindow_previousInputState(bfWindow* self)
 {
-  (void)g_BifrostPlatform.allocator(ptr, old_size, 0u, g_BifrostPlatform.user_data);
+  const BifrostWindowBase* const window = windowBaseCast(self);
+
+  return &window->input_state[window->input_current ^ 1u];
 }
 
+int bfWindow_isKeyDown(bfWindow* self, int key)
+{
+  return bfInputState_isKeyDown(bfWindow_inputState(self), key);
+}
 
-static void bfPlatformDoMainLoopImpl(void* arg)
+int bfWindow_wasKeyPressed(bfWindow* self, int key)
 {
-  bfWindow* main_window = (bfWindow*)arg;
+  const bfInputState* const current  = bfWindow_inputState(self);
+  const bfInputState* const previous = bfWindow_previousInputState(self);
+  const int                 word     = (key >> 6) & (k_bfInputStateKeyWords - 1);
 
-  bfPlatformPumpEvents();
+  return (int)(((current->keys[word] & ~previous->keys[word]) >> (key & 63)) & 1u);
+}
 
-  if (main_window->frame_fn)
+int bfWindow_wasKeyReleased(bfWindow* self, int key)
+{
+  const bfInputState* const current  = bfWindow_inputState(self);
+  const bfInputState* const previous = bfWindow_previousInputState(self);
+  const int                 word     = (key >> 6) & (k_bfInputStateKeyWords - 1);
+
+  return (int)(((~current->keys[word] & previous->keys[word]) >> (key & 63)) & 1u);
+}
+
+int bfWindow_wasButtonPressed(bfWindow* self, bfButtonFlags buttons)
+{
+  return (bfWindow_inputState(self)->buttons & ~bfWindow_previousInputState(self)->buttons & buttons) != 0;
+}
+
+int bfWindow_wasButtonReleased(bfWindow* self, bfButtonFlags buttons)
+{
+  return (~bfWindow_inputState(self)->buttons & bfWindow_previousInputState(self)->buttons & buttons) != 0;
+}
+
+int bfInputState_isKeyDown(const bfInputState* self, int key)
+{
+  return (int)((self->keys[(key >> 6) & (k_bfInputStateKeyWords - 1)] >> (key & 63)) & 1u);
+}
+
+void bfInputState_keysPressed(const bfInputState* current, const bfInputState* previous, uint64_t out_keys[k_bfInputStateKeyWords])
+{
+  int i;
+
+  for (i = 0; i < k_bfInputStateKeyWords; ++i)
   {
-    main_window->frame_fn(main_window);
+    out_keys[i] = current->keys[i] & ~previous->keys[i];
   }
+}
 
-#if BIFROST_PLATFORM_EMSCRIPTEN
-  // Needed only if " ctx_attribs.explicitSwapControl" is true.
-  // emscripten_webgl_commit_frame();
-  // emscripten_cancel_main_loop();
-#endif
+void bfInputState_keysReleased(const bfInputState* current, const bfInputState* previous, uint64_t out_keys[k_bfInputStateKeyWords])
+{
+  int i;
+
+  for (i = 0; i < k_bfInputStateKeyWords; ++i)
+  {
+    out_keys[i] = ~current->keys[i] & previous->keys[i];
+  }
 }
 
-void bfPlatformDoMainLoop(bfWindow* main_window)
+
+size_t bfPlatformPollEventsCompact(bfEventCompact* out, size_t max, uint64_t base_time)
 {
-#if BIFROST_PLATFORM_EMSCRIPTEN
-  emscripten_set_main_loop_arg(&bfPlatformDoMainLoopImpl, main_window, 0 /* could also be 60fps */, 1);
-#else
-  while (!bfWindow_wantsToClose(main_window))
+  bfEventQueue* const queue       = &s_EventQueue;
+  const size_t        head        = queue->head;
+  const size_t        num_queued  = bfAtomicLoadAcquire(&queue->tail) - head;
+  const size_t        num_to_read = num_queued < max ? num_queued : max;
+  size_t              i;
+
+  bfAtomicStoreRelease(&queue->released, head);
+
+  for (i = 0; i < num_to_read; ++i)
   {
-    bfPlatformDoMainLoopImpl(main_window);
+    out[i] = bfEventCompact_fromEvent(&queue->events[(head + i) & (BF_PLATFORM_EVENT_QUEUE_SIZE - 1)], base_time);
   }
-#endif
+
+  bfAtomicStoreRelease(&queue->head, head + num_to_read);
+
+  return num_to_read;
 }
 
-/* Events */
+size_t bfPlatformPollEvents(bfEvent* out, size_t max)
+{
+  bfEventQueue* const queue       = &s_EventQueue;
+  const size_t        head        = queue->head;
+  const size_t        num_queued  = bfAtomicLoadAcquire(&queue->tail) - head;
+  const size_t        num_to_read = num_queued < max ? num_queued : max;
+  size_t              i;
+
+  bfAtomicStoreRelease(&queue->released, head);
+
+  for (i = 0; i < num_to_read; ++i)
+  {
+    out[i] = queue->events[(head + i) & (BF_PLATFORM_EVENT_QUEUE_SIZE - 1)];
+  }
+
+  bfAtomicStoreRelease(&queue->head, head + num_to_read);
+
+  return num_to_read;
+}
 
 bfKeyboardEvent bfKeyboardEvent_makeKeyMod(int key, uint8_t modifiers)
 {
@@ -137,6 +1877,26 @@ bfMouseEvent bfMouseEvent_make(int x, int y, uint8_t target_button, bfButtonFlag
   return self;
 }
 
+bfMouseMotionEvent bfMouseMotionEvent_make(float x, float y, float delta_x, float delta_y)
+{
+  bfMouseMotionEvent self;
+  self.x       = x;
+  self.y       = y;
+  self.delta_x = delta_x;
+  self.delta_y = delta_y;
+
+  return self;
+}
+
+bfTextInputEvent bfTextInputEvent_make(const char* text, size_t length)
+{
+  bfTextInputEvent self;
+  self.text   = text;
+  self.length = length;
+
+  return self;
+}
+
 bfScrollWheelEvent bfScrollWheelEvent_make(double x, double y)
 {
   bfScrollWheelEvent self;
@@ -156,6 +1916,23 @@ bfWindowEvent bfWindowEvent_make(int width, int height, bfWindowFlags state)
   return self;
 }
 
+bfFileDropEvent bfFileDropEvent_make(const char* const* paths, size_t count)
+{
+  bfFileDropEvent self;
+  self.paths = paths;
+  self.count = count;
+
+  return self;
+}
+
+bfGamepadEvent bfGamepadEvent_make(int index)
+{
+  bfGamepadEvent self;
+  self.index = index;
+
+  return self;
+}
+
 struct bfEvent bfEvent_makeImpl(bfEventType type, uint8_t flags, const void* data, size_t data_size)
 {
 #if __cplusplus
@@ -166,11 +1943,183 @@ struct bfEvent bfEvent_makeImpl(bfEventType type, uint8_t flags, const void* dat
   self.flags = flags;
 #endif
 
+  self.timestamp = bfPlatformTimeNowNs();
+
   memcpy(&self.keyboard, data, data_size);
 
   return self;
 }
 
+static int16_t compactMouseCoord(float value)
+{
+  const float fixed = value * (float)k_bfEventCompactMouseScale;
+
+  return (int16_t)(fixed < (float)INT16_MIN ? INT16_MIN : fixed > (float)INT16_MAX ? INT16_MAX : fixed);
+}
+
+static uint16_t compactWindowSize(int value)
+{
+  return (uint16_t)(value < 0 ? 0 : value > UINT16_MAX ? UINT16_MAX : value);
+}
+
+bfEventCompact bfEventCompact_fromEvent(const bfEvent* evt, uint64_t base_time)
+{
+  const uint64_t time_us = evt->timestamp > base_time ? (evt->timestamp - base_time) / 1000u : 0u;
+  bfEventCompact self;
+
+  memset(&self, 0x0, sizeof(self));
+  self.type         = (uint8_t)evt->type;
+  self.flags        = evt->flags;
+  self.window_index = evt->receiver ? bfWindow_index(evt->receiver) : k_bfWindowIndexInvalid;
+  self.time_us      = time_us > UINT32_MAX ? UINT32_MAX : (uint32_t)time_us;
+
+  switch (evt->type)
+  {
+    case BIFROST_EVT_ON_KEY_DOWN:
+    case BIFROST_EVT_ON_KEY_HELD:
+    case BIFROST_EVT_ON_KEY_UP:
+    case BIFROST_EVT_ON_KEY_INPUT:
+    {
+      self.keyboard.key       = evt->keyboard.key;
+      self.keyboard.modifiers = evt->keyboard.modifiers;
+      break;
+    }
+    case BIFROST_EVT_ON_TEXT_INPUT:
+    {
+      self.text_input.length = evt->text_input.length > UINT32_MAX ? UINT32_MAX : (uint32_t)evt->text_input.length;
+      break;
+    }
+    case BIFROST_EVT_ON_MOUSE_DOWN:
+    case BIFROST_EVT_ON_MOUSE_MOVE:
+    case BIFROST_EVT_ON_MOUSE_UP:
+    {
+      self.mouse.x             = compactMouseCoord((float)evt->mouse.x);
+      self.mouse.y             = compactMouseCoord((float)evt->mouse.y);
+      self.mouse.target_button = evt->mouse.target_button;
+      self.mouse.button_state  = evt->mouse.button_state;
+      break;
+    }
+    case BIFROST_EVT_ON_MOUSE_MOTION:
+    {
+      self.mouse_motion.x       = compactMouseCoord(evt->mouse_motion.x);
+      self.mouse_motion.y       = compactMouseCoord(evt->mouse_motion.y);
+      self.mouse_motion.delta_x = compactMouseCoord(evt->mouse_motion.delta_x);
+      self.mouse_motion.delta_y = compactMouseCoord(evt->mouse_motion.delta_y);
+      break;
+    }
+    case BIFROST_EVT_ON_SCROLL_WHEEL:
+    {
+      self.scroll_wheel.x = (float)evt->scroll_wheel.x;
+      self.scroll_wheel.y = (float)evt->scroll_wheel.y;
+      break;
+    }
+    case BIFROST_EVT_ON_WINDOW_RESIZE:
+    case BIFROST_EVT_ON_WINDOW_CLOSE:
+    case BIFROST_EVT_ON_WINDOW_MINIMIZE:
+    case BIFROST_EVT_ON_WINDOW_FOCUS_CHANGED:
+    {
+      self.window.width  = compactWindowSize(evt->window.width);
+      self.window.height = compactWindowSize(evt->window.height);
+      self.window.state  = evt->window.state;
+      break;
+    }
+    case BIFROST_EVT_ON_FILE_DROP:
+    {
+      self.file_drop.count = evt->file_drop.count > UINT32_MAX ? UINT32_MAX : (uint32_t)evt->file_drop.count;
+      break;
+    }
+    case BIFROST_EVT_ON_GAMEPAD_CONNECTED:
+    case BIFROST_EVT_ON_GAMEPAD_DISCONNECTED:
+    {
+      self.gamepad.index = evt->gamepad.index;
+      break;
+    }
+    default:
+    {
+      break;
+    }
+  }
+
+  return self;
+}
+
+bfEvent bfEventCompact_toEvent(const bfEventCompact* evt, uint64_t base_time)
+{
+  bfEvent self;
+
+  memset(&self, 0x0, sizeof(self));
+  self.type      = (bfEventType)evt->type;
+  self.flags     = evt->flags;
+  self.receiver  = bfPlatformWindowFromIndex(evt->window_index);
+  self.timestamp = base_time + (uint64_t)evt->time_us * 1000u;
+
+  switch (self.type)
+  {
+    case BIFROST_EVT_ON_KEY_DOWN:
+    case BIFROST_EVT_ON_KEY_HELD:
+    case BIFROST_EVT_ON_KEY_UP:
+    case BIFROST_EVT_ON_KEY_INPUT:
+    {
+      self.keyboard = bfKeyboardEvent_makeKeyMod(evt->keyboard.key, evt->keyboard.modifiers);
+      break;
+    }
+    case BIFROST_EVT_ON_TEXT_INPUT:
+    {
+      /* NOTE(SR): The text was not stored, empty rather than NULL so consumers never read through a bad pointer. */
+      self.text_input = bfTextInputEvent_make("", 0u);
+      break;
+    }
+    case BIFROST_EVT_ON_MOUSE_DOWN:
+    case BIFROST_EVT_ON_MOUSE_MOVE:
+    case BIFROST_EVT_ON_MOUSE_UP:
+    {
+      self.mouse = bfMouseEvent_make(evt->mouse.x / k_bfEventCompactMouseScale,
+                                     evt->mouse.y / k_bfEventCompactMouseScale,
+                                     evt->mouse.target_button,
+                                     evt->mouse.button_state);
+      break;
+    }
+    case BIFROST_EVT_ON_MOUSE_MOTION:
+    {
+      self.mouse_motion = bfMouseMotionEvent_make((float)evt->mouse_motion.x / k_bfEventCompactMouseScale,
+                                                  (float)evt->mouse_motion.y / k_bfEventCompactMouseScale,
+                                                  (float)evt->mouse_motion.delta_x / k_bfEventCompactMouseScale,
+                                                  (float)evt->mouse_motion.delta_y / k_bfEventCompactMouseScale);
+      break;
+    }
+    case BIFROST_EVT_ON_SCROLL_WHEEL:
+    {
+      self.scroll_wheel = bfScrollWheelEvent_make(evt->scroll_wheel.x, evt->scroll_wheel.y);
+      break;
+    }
+    case BIFROST_EVT_ON_WINDOW_RESIZE:
+    case BIFROST_EVT_ON_WINDOW_CLOSE:
+    case BIFROST_EVT_ON_WINDOW_MINIMIZE:
+    case BIFROST_EVT_ON_WINDOW_FOCUS_CHANGED:
+    {
+      self.window = bfWindowEvent_make(evt->window.width, evt->window.height, evt->window.state);
+      break;
+    }
+    case BIFROST_EVT_ON_FILE_DROP:
+    {
+      self.file_drop = bfFileDropEvent_make(NULL, 0u);
+      break;
+    }
+    case BIFROST_EVT_ON_GAMEPAD_CONNECTED:
+    case BIFROST_EVT_ON_GAMEPAD_DISCONNECTED:
+    {
+      self.gamepad = bfGamepadEvent_make(evt->gamepad.index);
+      break;
+    }
+    default:
+    {
+      break;
+    }
+  }
+
+  return self;
+}
+
 /******************************************************************************/
 /*
   MIT License
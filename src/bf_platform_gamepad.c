@@ -0,0 +1,215 @@
+#include "bf_platform_internal.h"
+
+#include "bf/platform/bf_platform_gamepad.h"
+
+#include <math.h>   /* sqrtf  */
+#include <string.h> /* memset */
+
+#if k_bfGamepadMax > 32
+#error "'bfGamepadState::connected' has a bit per pad."
+#endif
+
+static bfGamepadSource s_GamepadSource; /*!< A NULL 'poll' means use 'bfPlatformDefaultGamepadSource'. */
+static bfGamepadState  s_GamepadStates[2];
+static uint8_t         s_GamepadCurrent         = 0;
+static float           s_GamepadStickDeadzone   = 0.2f;
+static float           s_GamepadTriggerDeadzone = 0.1f;
+
+static bfGamepadSource currentSource(void)
+{
+  return s_GamepadSource.poll ? s_GamepadSource : bfPlatformDefaultGamepadSource();
+}
+
+static int isValidIndex(int index)
+{
+  return index >= 0 && index < k_bfGamepadMax;
+}
+
+/*
+  NOTE(SR):
+    The deadzone passes go over every pad at once with no early outs
+    so the compiler is free to vectorize them, disconnected pads are
+    all zeros so they come out as zero.
+*/
+
+static void applyStickDeadzone(float xs[k_bfGamepadMax], float ys[k_bfGamepadMax], float deadzone)
+{
+  const float inv_range = 1.0f / (1.0f - deadzone);
+  int         i;
+
+  for (i = 0; i < k_bfGamepadMax; ++i)
+  {
+    const float length  = sqrtf(xs[i] * xs[i] + ys[i] * ys[i]);
+    const float scaled  = (length - deadzone) * inv_range;
+    const float clamped = length > deadzone ? (scaled > 1.0f ? 1.0f : scaled) : 0.0f;
+    const float scale   = clamped / (length > 0.0f ? length : 1.0f);
+
+    xs[i] *= scale;
+    ys[i] *= scale;
+  }
+}
+
+static void applyTriggerDeadzone(float values[k_bfGamepadMax], float deadzone)
+{
+  const float inv_range = 1.0f / (1.0f - deadzone);
+  int         i;
+
+  for (i = 0; i < k_bfGamepadMax; ++i)
+  {
+    const float scaled = (values[i] - deadzone) * inv_range;
+
+    values[i] = scaled < 0.0f ? 0.0f : scaled > 1.0f ? 1.0f : scaled;
+  }
+}
+
+static void dispatchConnectionEvents(uint32_t old_connected, uint32_t new_connected)
+{
+  bfWindow* const window  = bfPlatformFirstWindow();
+  uint32_t        changed = old_connected ^ new_connected;
+  int             i;
+
+  if (!window)
+  {
+    return;
+  }
+
+  for (i = 0; changed; ++i, changed >>= 1)
+  {
+    if (changed & 1u)
+    {
+      const bfEventType type     = (new_connected >> i) & 1u ? BIFROST_EVT_ON_GAMEPAD_CONNECTED : BIFROST_EVT_ON_GAMEPAD_DISCONNECTED;
+      bfGamepadEvent    evt_data = bfGamepadEvent_make(i);
+
+      bfPlatformDispatchEvent(window, bfEvent_make(type, 0x0, evt_data));
+    }
+  }
+}
+
+void bfPlatformUpdateGamepads(void)
+{
+  const bfGamepadSource source        = currentSource();
+  const uint32_t        old_connected = s_GamepadStates[s_GamepadCurrent].connected;
+  bfGamepadState* const state         = &s_GamepadStates[s_GamepadCurrent ^= 1u];
+  int                   i;
+
+  memset(state, 0x0, sizeof(*state));
+
+  for (i = 0; i < k_bfGamepadMax; ++i)
+  {
+    bfGamepadRawState raw;
+
+    if (source.poll(source.user_data, i, &raw))
+    {
+      int axis;
+
+      state->connected |= 1u << i;
+      state->buttons[i] = raw.buttons;
+
+      for (axis = 0; axis < BIFROST_GAMEPAD_AXIS_MAX; ++axis)
+      {
+        state->axes[axis][i] = raw.axes[axis];
+      }
+    }
+  }
+
+  applyStickDeadzone(state->axes[BIFROST_GAMEPAD_AXIS_LEFT_X], state->axes[BIFROST_GAMEPAD_AXIS_LEFT_Y], s_GamepadStickDeadzone);
+  applyStickDeadzone(state->axes[BIFROST_GAMEPAD_AXIS_RIGHT_X], state->axes[BIFROST_GAMEPAD_AXIS_RIGHT_Y], s_GamepadStickDeadzone);
+  applyTriggerDeadzone(state->axes[BIFROST_GAMEPAD_AXIS_LEFT_TRIGGER], s_GamepadTriggerDeadzone);
+  applyTriggerDeadzone(state->axes[BIFROST_GAMEPAD_AXIS_RIGHT_TRIGGER], s_GamepadTriggerDeadzone);
+
+  dispatchConnectionEvents(old_connected, state->connected);
+}
+
+void bfPlatformSetGamepadSource(const bfGamepadSource* source)
+{
+  if (source)
+  {
+    s_GamepadSource = *source;
+  }
+  else
+  {
+    memset(&s_GamepadSource, 0x0, sizeof(s_GamepadSource));
+  }
+}
+
+const bfGamepadState* bfPlatformGamepadState(void)
+{
+  return &s_GamepadStates[s_GamepadCurrent];
+}
+
+const bfGamepadState* bfPlatformGamepadPreviousState(void)
+{
+  return &s_GamepadStates[s_GamepadCurrent ^ 1u];
+}
+
+void bfPlatformSetGamepadDeadzone(float stick, float trigger)
+{
+  /* NOTE(SR): Kept below one so the rescale never divides by zero. */
+  s_GamepadStickDeadzone   = stick < 0.0f ? 0.0f : stick > 0.99f ? 0.99f : stick;
+  s_GamepadTriggerDeadzone = trigger < 0.0f ? 0.0f : trigger > 0.99f ? 0.99f : trigger;
+}
+
+int bfGamepad_isConnected(int index)
+{
+  return isValidIndex(index) && ((bfPlatformGamepadState()->connected >> index) & 1u);
+}
+
+const char* bfGamepad_name(int index)
+{
+  if (bfGamepad_isConnected(index))
+  {
+    const bfGamepadSource source = currentSource();
+
+    return source.name ? source.name(source.user_data, index) : NULL;
+  }
+
+  return NULL;
+}
+
+int bfGamepad_isButtonDown(int index, bfGamepadButton button)
+{
+  return isValidIndex(index) && (bfPlatformGamepadState()->buttons[index] & bfGamepadButtonMask(button)) != 0;
+}
+
+int bfGamepad_wasButtonPressed(int index, bfGamepadButton button)
+{
+  return isValidIndex(index) &&
+         (bfPlatformGamepadState()->buttons[index] & ~bfPlatformGamepadPreviousState()->buttons[index] & bfGamepadButtonMask(button)) != 0;
+}
+
+int bfGamepad_wasButtonReleased(int index, bfGamepadButton button)
+{
+  return isValidIndex(index) &&
+         (~bfPlatformGamepadState()->buttons[index] & bfPlatformGamepadPreviousState()->buttons[index] & bfGamepadButtonMask(button)) != 0;
+}
+
+float bfGamepad_axis(int index, bfGamepadAxis axis)
+{
+  return isValidIndex(index) ? bfPlatformGamepadState()->axes[axis][index] : 0.0f;
+}
+
+/******************************************************************************/
+/*
+  MIT License
+
+  Copyright (c) 2020 Shareef Abdoul-Raheem
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+/******************************************************************************/
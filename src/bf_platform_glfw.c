@@ -1,6 +1,5 @@
-#include "bf/platform/bf_platform.h"
+#include "bf_platform_internal.h"
 
-#include "bf/platform/bf_platform_event.h"
 #include "bf/platform/bf_platform_gl.h"
 #include "bf/platform/bf_platform_vulkan.h"
 
@@ -11,11 +10,25 @@
 #include <emscripten/html5.h>  // EmscriptenWebGLContextAttributes etc
 #endif
 
-#include <assert.h>
+#include <assert.h> /* assert         */
+#include <string.h> /* memcpy, strlen */
 
-extern bfPlatformInitParams g_BifrostPlatform;
+typedef struct
+{
+  BifrostWindowBase super;
+  bfButtonFlags     button_state; /*!< Kept up to date by 'GLFW_onMouseButtonChanged' so mouse moves do not need to query every button. */
+  double            cursor_x;     /*!< Last position from 'GLFW_onMousePosChanged' for computing motion deltas.                         */
+  double            cursor_y;     /*!< Last position from 'GLFW_onMousePosChanged' for computing motion deltas.                         */
+
+} BifrostWindowGLFW;
+
+static bfWindow*      s_MainWindow = NULL;
+static bfPlatformPool s_WindowPool; /*!< Every 'BifrostWindowGLFW' is allocated from here so live windows sit next to each other. */
 
-static bfWindow* s_MainWindow = NULL;
+static BifrostWindowGLFW* windowCast(bfWindow* window)
+{
+  return (BifrostWindowGLFW*)window;
+}
 
 int bfPlatformInit(bfPlatformInitParams params)
 {
@@ -28,7 +41,15 @@ int bfPlatformInit(bfPlatformInitParams params)
     if (!g_BifrostPlatform.allocator)
     {
       g_BifrostPlatform.allocator = &bfPlatformDefaultAllocator;
+
+      if (!g_BifrostPlatform.aligned_allocator)
+      {
+        g_BifrostPlatform.aligned_allocator = &bfPlatformDefaultAlignedAllocator;
+      }
     }
+
+    bfPlatformPool_init(&s_WindowPool, sizeof(BifrostWindowGLFW), 0u);
+    s_WindowPool.tag = BF_PLATFORM_MEMORY_TAG_WINDOW;
   }
 
   return was_success;
@@ -36,66 +57,95 @@ int bfPlatformInit(bfPlatformInitParams params)
 
 void bfPlatformPumpEvents(void)
 {
+  bfPlatformBeginPumpEvents();
+  bfProfileZoneBegin("glfwPollEvents");
   glfwPollEvents();
+  bfProfileZoneEnd();
+  bfPlatformEndPumpEvents();
 }
 
-#if 0
+void bfPlatformWaitEvents(void)
+{
+  bfPlatformBeginPumpEvents();
+  bfProfileZoneBegin("glfwWaitEvents");
+  glfwWaitEvents();
+  bfProfileZoneEnd();
+  bfPlatformEndPumpEvents();
+}
 
-  bool startupGLFW(glfw::ControllerEventCallback* onControllerEvent, glfw::ErrorCallback* onGLFWError)
-  {
-    s_onControllerEvent = onControllerEvent;
-    s_onGLFWError       = onGLFWError;
+void bfPlatformWaitEventsTimeout(uint64_t timeout_ns)
+{
+  bfPlatformBeginPumpEvents();
+  bfProfileZoneBegin("glfwWaitEventsTimeout");
+  glfwWaitEventsTimeout((double)timeout_ns * 1.0e-9);
+  bfProfileZoneEnd();
+  bfPlatformEndPumpEvents();
+}
 
-    glfwSetJoystickCallback(GLFW_onJoystickStateChanged);
-    glfwSetErrorCallback(GLFW_errorCallback);
+void bfPlatformWakeUp(void)
+{
+  glfwPostEmptyEvent();
+}
 
-    glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+/* Gamepads */
 
-    return false;
-  }
+#if k_bfGamepadMax > (GLFW_JOYSTICK_LAST + 1)
+#error "GLFW can not track that many gamepads."
+#endif
 
-  void GLFW_onJoystickStateChanged(int joy, int event)
+static int GLFW_pollGamepad(void* user_data, int index, bfGamepadRawState* out)
+{
+  GLFWgamepadstate state;
+  int              i;
+
+  (void)user_data;
+
+  if (!glfwGetGamepadState(GLFW_JOYSTICK_1 + index, &state))
   {
-    if (s_onControllerEvent)
-    {
-      const char* name = glfwGetJoystickName(joy);
+    return 0;
+  }
 
-      ControllerEvent::Type evt_type = ControllerEvent::ON_CONTROLLER_CONNECTED;
+  out->buttons = 0x0;
 
-      if (event == GLFW_CONNECTED)
-      {
-        evt_type = ControllerEvent::ON_CONTROLLER_CONNECTED;
-      }
-      else if (event == GLFW_DISCONNECTED)
-      {
-        evt_type = ControllerEvent::ON_CONTROLLER_DISCONNECTED;
-      }
+  for (i = 0; i < BIFROST_GAMEPAD_BUTTON_MAX; ++i)
+  {
+    out->buttons |= (uint32_t)(state.buttons[i] == GLFW_PRESS) << i;
+  }
 
-      s_onControllerEvent->safeCall(ControllerEvent(evt_type, name, joy));
-    }
+  for (i = 0; i < BIFROST_GAMEPAD_AXIS_LEFT_TRIGGER; ++i)
+  {
+    out->axes[i] = state.axes[i];
   }
 
-static void GLFW_errorCallback(int errorCode, const char* message)
-{
-  if (s_onGLFWError)
+  /* NOTE(SR): GLFW triggers rest at -1. */
+  for (; i < BIFROST_GAMEPAD_AXIS_MAX; ++i)
   {
-    s_onGLFWError->safeCall(errorCode, message);
+    out->axes[i] = (state.axes[i] + 1.0f) * 0.5f;
   }
+
+  return 1;
 }
-#endif
 
-static bfWindow* getWindow(GLFWwindow* window)
+static const char* GLFW_gamepadName(void* user_data, int index)
 {
-  return (bfWindow*)glfwGetWindowUserPointer(window);
+  (void)user_data;
+
+  return glfwGetGamepadName(GLFW_JOYSTICK_1 + index);
 }
 
-static void dispatchEvent(bfWindow* window, bfEvent event)
+bfGamepadSource bfPlatformDefaultGamepadSource(void)
 {
-  if (window->event_fn)
-  {
-    event.receiver = window;
-    window->event_fn(window, &event);
-  }
+  bfGamepadSource self;
+  self.user_data = NULL;
+  self.poll      = &GLFW_pollGamepad;
+  self.name      = &GLFW_gamepadName;
+
+  return self;
+}
+
+static bfWindow* getWindow(GLFWwindow* window)
+{
+  return (bfWindow*)glfwGetWindowUserPointer(window);
 }
 
 static bfKeyModifiers convertKeyModifiers(int mods)
@@ -135,79 +185,145 @@ static bfKeyModifiers convertKeyModifiers(int mods)
   return result;
 }
 
-static bfButtonFlags convertButtonState(GLFWwindow* window)
-{
-  bfButtonFlags result = 0x0;
-
-  for (int i = GLFW_MOUSE_BUTTON_1; i <= GLFW_MOUSE_BUTTON_LAST; ++i)
-  {
-    if (glfwGetMouseButton(window, i) == GLFW_PRESS)
-    {
-      result |= (1 << i);
-    }
-  }
-
-  return result;
-}
+/*
+  NOTE(SR):
+    Indexed by the GLFW key plus one so that 'GLFW_KEY_UNKNOWN' (-1)
+    has a slot, any GLFW key not listed is 'BIFROST_KEY_UNKNOWN' (0).
+*/
+// clang-format off
+static const int16_t k_GLFWToBifrostKey[GLFW_KEY_LAST + 2] =
+{
+  [GLFW_KEY_SPACE + 1]         = BIFROST_KEY_SPACE,
+  [GLFW_KEY_APOSTROPHE + 1]    = BIFROST_KEY_APOSTROPHE,
+  [GLFW_KEY_COMMA + 1]         = BIFROST_KEY_COMMA,
+  [GLFW_KEY_MINUS + 1]         = BIFROST_KEY_MINUS,
+  [GLFW_KEY_PERIOD + 1]        = BIFROST_KEY_PERIOD,
+  [GLFW_KEY_SLASH + 1]         = BIFROST_KEY_SLASH,
+  [GLFW_KEY_0 + 1]             = BIFROST_KEY_0,
+  [GLFW_KEY_1 + 1]             = BIFROST_KEY_1,
+  [GLFW_KEY_2 + 1]             = BIFROST_KEY_2,
+  [GLFW_KEY_3 + 1]             = BIFROST_KEY_3,
+  [GLFW_KEY_4 + 1]             = BIFROST_KEY_4,
+  [GLFW_KEY_5 + 1]             = BIFROST_KEY_5,
+  [GLFW_KEY_6 + 1]             = BIFROST_KEY_6,
+  [GLFW_KEY_7 + 1]             = BIFROST_KEY_7,
+  [GLFW_KEY_8 + 1]             = BIFROST_KEY_8,
+  [GLFW_KEY_9 + 1]             = BIFROST_KEY_9,
+  [GLFW_KEY_SEMICOLON + 1]     = BIFROST_KEY_SEMICOLON,
+  [GLFW_KEY_EQUAL + 1]         = BIFROST_KEY_EQUAL,
+  [GLFW_KEY_A + 1]             = BIFROST_KEY_A,
+  [GLFW_KEY_B + 1]             = BIFROST_KEY_B,
+  [GLFW_KEY_C + 1]             = BIFROST_KEY_C,
+  [GLFW_KEY_D + 1]             = BIFROST_KEY_D,
+  [GLFW_KEY_E + 1]             = BIFROST_KEY_E,
+  [GLFW_KEY_F + 1]             = BIFROST_KEY_F,
+  [GLFW_KEY_G + 1]             = BIFROST_KEY_G,
+  [GLFW_KEY_H + 1]             = BIFROST_KEY_H,
+  [GLFW_KEY_I + 1]             = BIFROST_KEY_I,
+  [GLFW_KEY_J + 1]             = BIFROST_KEY_J,
+  [GLFW_KEY_K + 1]             = BIFROST_KEY_K,
+  [GLFW_KEY_L + 1]             = BIFROST_KEY_L,
+  [GLFW_KEY_M + 1]             = BIFROST_KEY_M,
+  [GLFW_KEY_N + 1]             = BIFROST_KEY_N,
+  [GLFW_KEY_O + 1]             = BIFROST_KEY_O,
+  [GLFW_KEY_P + 1]             = BIFROST_KEY_P,
+  [GLFW_KEY_Q + 1]             = BIFROST_KEY_Q,
+  [GLFW_KEY_R + 1]             = BIFROST_KEY_R,
+  [GLFW_KEY_S + 1]             = BIFROST_KEY_S,
+  [GLFW_KEY_T + 1]             = BIFROST_KEY_T,
+  [GLFW_KEY_U + 1]             = BIFROST_KEY_U,
+  [GLFW_KEY_V + 1]             = BIFROST_KEY_V,
+  [GLFW_KEY_W + 1]             = BIFROST_KEY_W,
+  [GLFW_KEY_X + 1]             = BIFROST_KEY_X,
+  [GLFW_KEY_Y + 1]             = BIFROST_KEY_Y,
+  [GLFW_KEY_Z + 1]             = BIFROST_KEY_Z,
+  [GLFW_KEY_LEFT_BRACKET + 1]  = BIFROST_KEY_LEFT_BRACKET,
+  [GLFW_KEY_BACKSLASH + 1]     = BIFROST_KEY_BACKSLASH,
+  [GLFW_KEY_RIGHT_BRACKET + 1] = BIFROST_KEY_RIGHT_BRACKET,
+  [GLFW_KEY_GRAVE_ACCENT + 1]  = BIFROST_KEY_GRAVE_ACCENT,
+  [GLFW_KEY_ESCAPE + 1]        = BIFROST_KEY_ESCAPE,
+  [GLFW_KEY_ENTER + 1]         = BIFROST_KEY_ENTER,
+  [GLFW_KEY_TAB + 1]           = BIFROST_KEY_TAB,
+  [GLFW_KEY_BACKSPACE + 1]     = BIFROST_KEY_BACKSPACE,
+  [GLFW_KEY_INSERT + 1]        = BIFROST_KEY_INSERT,
+  [GLFW_KEY_DELETE + 1]        = BIFROST_KEY_DELETE,
+  [GLFW_KEY_RIGHT + 1]         = BIFROST_KEY_RIGHT,
+  [GLFW_KEY_LEFT + 1]          = BIFROST_KEY_LEFT,
+  [GLFW_KEY_DOWN + 1]          = BIFROST_KEY_DOWN,
+  [GLFW_KEY_UP + 1]            = BIFROST_KEY_UP,
+  [GLFW_KEY_PAGE_UP + 1]       = BIFROST_KEY_PAGE_UP,
+  [GLFW_KEY_PAGE_DOWN + 1]     = BIFROST_KEY_PAGE_DOWN,
+  [GLFW_KEY_HOME + 1]          = BIFROST_KEY_HOME,
+  [GLFW_KEY_END + 1]           = BIFROST_KEY_END,
+  [GLFW_KEY_CAPS_LOCK + 1]     = BIFROST_KEY_CAPS_LOCK,
+  [GLFW_KEY_SCROLL_LOCK + 1]   = BIFROST_KEY_SCROLL_LOCK,
+  [GLFW_KEY_NUM_LOCK + 1]      = BIFROST_KEY_NUM_LOCK,
+  [GLFW_KEY_PRINT_SCREEN + 1]  = BIFROST_KEY_PRINT_SCREEN,
+  [GLFW_KEY_PAUSE + 1]         = BIFROST_KEY_PAUSE,
+  [GLFW_KEY_F1 + 1]            = BIFROST_KEY_F1,
+  [GLFW_KEY_F2 + 1]            = BIFROST_KEY_F2,
+  [GLFW_KEY_F3 + 1]            = BIFROST_KEY_F3,
+  [GLFW_KEY_F4 + 1]            = BIFROST_KEY_F4,
+  [GLFW_KEY_F5 + 1]            = BIFROST_KEY_F5,
+  [GLFW_KEY_F6 + 1]            = BIFROST_KEY_F6,
+  [GLFW_KEY_F7 + 1]            = BIFROST_KEY_F7,
+  [GLFW_KEY_F8 + 1]            = BIFROST_KEY_F8,
+  [GLFW_KEY_F9 + 1]            = BIFROST_KEY_F9,
+  [GLFW_KEY_F10 + 1]           = BIFROST_KEY_F10,
+  [GLFW_KEY_F11 + 1]           = BIFROST_KEY_F11,
+  [GLFW_KEY_F12 + 1]           = BIFROST_KEY_F12,
+  [GLFW_KEY_F13 + 1]           = BIFROST_KEY_F13,
+  [GLFW_KEY_F14 + 1]           = BIFROST_KEY_F14,
+  [GLFW_KEY_F15 + 1]           = BIFROST_KEY_F15,
+  [GLFW_KEY_F16 + 1]           = BIFROST_KEY_F16,
+  [GLFW_KEY_F17 + 1]           = BIFROST_KEY_F17,
+  [GLFW_KEY_F18 + 1]           = BIFROST_KEY_F18,
+  [GLFW_KEY_F19 + 1]           = BIFROST_KEY_F19,
+  [GLFW_KEY_F20 + 1]           = BIFROST_KEY_F20,
+  [GLFW_KEY_F21 + 1]           = BIFROST_KEY_F21,
+  [GLFW_KEY_F22 + 1]           = BIFROST_KEY_F22,
+  [GLFW_KEY_F23 + 1]           = BIFROST_KEY_F23,
+  [GLFW_KEY_F24 + 1]           = BIFROST_KEY_F24,
+  [GLFW_KEY_F25 + 1]           = BIFROST_KEY_F25,
+  [GLFW_KEY_KP_0 + 1]          = BIFROST_KEY_PAD_0,
+  [GLFW_KEY_KP_1 + 1]          = BIFROST_KEY_PAD_1,
+  [GLFW_KEY_KP_2 + 1]          = BIFROST_KEY_PAD_2,
+  [GLFW_KEY_KP_3 + 1]          = BIFROST_KEY_PAD_3,
+  [GLFW_KEY_KP_4 + 1]          = BIFROST_KEY_PAD_4,
+  [GLFW_KEY_KP_5 + 1]          = BIFROST_KEY_PAD_5,
+  [GLFW_KEY_KP_6 + 1]          = BIFROST_KEY_PAD_6,
+  [GLFW_KEY_KP_7 + 1]          = BIFROST_KEY_PAD_7,
+  [GLFW_KEY_KP_8 + 1]          = BIFROST_KEY_PAD_8,
+  [GLFW_KEY_KP_9 + 1]          = BIFROST_KEY_PAD_9,
+  [GLFW_KEY_KP_DECIMAL + 1]    = BIFROST_KEY_PAD_DECIMAL,
+  [GLFW_KEY_KP_DIVIDE + 1]     = BIFROST_KEY_PAD_DIVIDE,
+  [GLFW_KEY_KP_MULTIPLY + 1]   = BIFROST_KEY_PAD_MULTIPLY,
+  [GLFW_KEY_KP_SUBTRACT + 1]   = BIFROST_KEY_PAD_SUBTRACT,
+  [GLFW_KEY_KP_ADD + 1]        = BIFROST_KEY_PAD_ADD,
+  [GLFW_KEY_KP_ENTER + 1]      = BIFROST_KEY_PAD_ENTER,
+  [GLFW_KEY_KP_EQUAL + 1]      = BIFROST_KEY_PAD_EQUAL,
+  [GLFW_KEY_LEFT_SHIFT + 1]    = BIFROST_KEY_LEFT_SHIFT,
+  [GLFW_KEY_LEFT_CONTROL + 1]  = BIFROST_KEY_LEFT_CONTROL,
+  [GLFW_KEY_LEFT_ALT + 1]      = BIFROST_KEY_LEFT_ALT,
+  [GLFW_KEY_LEFT_SUPER + 1]    = BIFROST_KEY_LEFT_SUPER,
+  [GLFW_KEY_RIGHT_SHIFT + 1]   = BIFROST_KEY_RIGHT_SHIFT,
+  [GLFW_KEY_RIGHT_CONTROL + 1] = BIFROST_KEY_RIGHT_CONTROL,
+  [GLFW_KEY_RIGHT_ALT + 1]     = BIFROST_KEY_RIGHT_ALT,
+  [GLFW_KEY_RIGHT_SUPER + 1]   = BIFROST_KEY_RIGHT_SUPER,
+  [GLFW_KEY_MENU + 1]          = BIFROST_KEY_MENU,
+};
+// clang-format on
 
 static int convertKey(int key)
 {
-  switch (key)
-  {
-    case GLFW_KEY_ESCAPE: return BIFROST_KEY_ESCAPE;
-    case GLFW_KEY_ENTER: return BIFROST_KEY_ENTER;
-    case GLFW_KEY_TAB: return BIFROST_KEY_TAB;
-    case GLFW_KEY_LEFT: return BIFROST_KEY_LEFT;
-    case GLFW_KEY_RIGHT: return BIFROST_KEY_RIGHT;
-    case GLFW_KEY_UP: return BIFROST_KEY_UP;
-    case GLFW_KEY_DOWN: return BIFROST_KEY_DOWN;
-    case GLFW_KEY_PAGE_UP: return BIFROST_KEY_PAGE_UP;
-    case GLFW_KEY_PAGE_DOWN: return BIFROST_KEY_PAGE_DOWN;
-    case GLFW_KEY_HOME: return BIFROST_KEY_HOME;
-    case GLFW_KEY_END: return BIFROST_KEY_END;
-    case GLFW_KEY_INSERT: return BIFROST_KEY_INSERT;
-    case GLFW_KEY_DELETE: return BIFROST_KEY_DELETE;
-    case GLFW_KEY_BACKSPACE: return BIFROST_KEY_BACKSPACE;
-    case GLFW_KEY_KP_ENTER: return BIFROST_KEY_PAD_ENTER;
-
-    case GLFW_KEY_SPACE: return BIFROST_KEY_SPACE;
-
-    case GLFW_KEY_A: return BIFROST_KEY_A;
-    case GLFW_KEY_B: return BIFROST_KEY_B;
-    case GLFW_KEY_C: return BIFROST_KEY_C;
-    case GLFW_KEY_D: return BIFROST_KEY_D;
-    case GLFW_KEY_E: return BIFROST_KEY_E;
-    case GLFW_KEY_F: return BIFROST_KEY_F;
-    case GLFW_KEY_G: return BIFROST_KEY_G;
-    case GLFW_KEY_H: return BIFROST_KEY_H;
-    case GLFW_KEY_I: return BIFROST_KEY_I;
-    case GLFW_KEY_J: return BIFROST_KEY_J;
-    case GLFW_KEY_K: return BIFROST_KEY_K;
-    case GLFW_KEY_L: return BIFROST_KEY_L;
-    case GLFW_KEY_M: return BIFROST_KEY_M;
-    case GLFW_KEY_N: return BIFROST_KEY_N;
-    case GLFW_KEY_O: return BIFROST_KEY_O;
-    case GLFW_KEY_P: return BIFROST_KEY_P;
-    case GLFW_KEY_Q: return BIFROST_KEY_Q;
-    case GLFW_KEY_R: return BIFROST_KEY_R;
-    case GLFW_KEY_S: return BIFROST_KEY_S;
-    case GLFW_KEY_T: return BIFROST_KEY_T;
-    case GLFW_KEY_U: return BIFROST_KEY_U;
-    case GLFW_KEY_V: return BIFROST_KEY_V;
-    case GLFW_KEY_W: return BIFROST_KEY_W;
-    case GLFW_KEY_X: return BIFROST_KEY_X;
-    case GLFW_KEY_Y: return BIFROST_KEY_Y;
-    case GLFW_KEY_Z: return BIFROST_KEY_Z;
-
-    default: return key;
-  }
+  return k_GLFWToBifrostKey[key + 1];
 }
 
 static void GLFW_onKeyChanged(GLFWwindow* window, int key, int scan_code, int action, int mods)
 {
   const int converted_key = convertKey(key);
 
-  if (converted_key != -1)
+  if (converted_key != BIFROST_KEY_UNKNOWN)
   {
     bfEventType evt_type;
 
@@ -234,26 +350,45 @@ static void GLFW_onKeyChanged(GLFWwindow* window, int key, int scan_code, int ac
         // bfInvalidDefaultCase();
     }
 
+    bfWindow* const w = getWindow(window);
+
+    /* NOTE(SR): Repeats do not change 'bfInputState' so can be dropped early. */
+    if (evt_type == BIFROST_EVT_ON_KEY_HELD && !BifrostWindowBase_wantsEvent(windowBaseCast(w), evt_type))
+    {
+      return;
+    }
+
     bfKeyboardEvent evt_data = bfKeyboardEvent_makeKeyMod(converted_key, convertKeyModifiers(mods));
 
-    dispatchEvent(getWindow(window), bfEvent_make(evt_type, 0x0, evt_data));
+    bfPlatformDispatchEvent(w, bfEvent_make(evt_type, 0x0, evt_data));
   }
 }
 
 static void GLFW_onMousePosChanged(GLFWwindow* window, double x_pos, double y_pos)
 {
-  bfWindow* const w        = getWindow(window);
-  bfMouseEvent    evt_data = bfMouseEvent_make((int)(x_pos), (int)(y_pos), BIFROST_BUTTON_NONE, convertButtonState(window));
+  bfWindow* const          w      = getWindow(window);
+  BifrostWindowGLFW* const w_glfw = windowCast(w);
+
+  if (BifrostWindowBase_wantsEvent(&w_glfw->super, BIFROST_EVT_ON_MOUSE_MOVE))
+  {
+    bfMouseEvent evt_data = bfMouseEvent_make((int)(x_pos), (int)(y_pos), BIFROST_BUTTON_NONE, w_glfw->button_state);
 
-  dispatchEvent(w, bfEvent_make(BIFROST_EVT_ON_MOUSE_MOVE, 0x0, evt_data));
+    bfPlatformDispatchEvent(w, bfEvent_make(BIFROST_EVT_ON_MOUSE_MOVE, 0x0, evt_data));
+  }
+
+  /* NOTE(SR): Always sent, it keeps the 'bfInputState' mouse position and delta up to date before the mask is applied. */
+  bfMouseMotionEvent evt_data = bfMouseMotionEvent_make((float)x_pos, (float)y_pos, (float)(x_pos - w_glfw->cursor_x), (float)(y_pos - w_glfw->cursor_y));
+
+  w_glfw->cursor_x = x_pos;
+  w_glfw->cursor_y = y_pos;
+
+  bfPlatformDispatchEvent(w, bfEvent_make(BIFROST_EVT_ON_MOUSE_MOTION, 0x0, evt_data));
 }
 
 static void GLFW_onMouseButtonChanged(GLFWwindow* window, int button, int action, int mods)
 {
-  bfWindow* const w = getWindow(window);
-
-  double x_pos, y_pos;
-  glfwGetCursorPos(window, &x_pos, &y_pos);
+  bfWindow* const          w      = getWindow(window);
+  BifrostWindowGLFW* const w_glfw = windowCast(w);
 
   bfEventType evt_type;
 
@@ -326,16 +461,79 @@ static void GLFW_onMouseButtonChanged(GLFWwindow* window, int button, int action
     }
   }
 
-  bfMouseEvent evt_data = bfMouseEvent_make((int)(x_pos), (int)(y_pos), target_button, convertButtonState(window));
+  if (target_button != (uint8_t)BIFROST_BUTTON_NONE)
+  {
+    if (evt_type == BIFROST_EVT_ON_MOUSE_DOWN)
+    {
+      w_glfw->button_state |= target_button;
+    }
+    else
+    {
+      w_glfw->button_state &= (bfButtonFlags)~target_button;
+    }
+  }
+
+  double x_pos, y_pos;
+
+  /*
+    NOTE(SR):
+      The cursor position is only queried when someone will see it,
+      otherwise the input state already has it from 'GLFW_onMousePosChanged'.
+  */
+  if (BifrostWindowBase_wantsEvent(&w_glfw->super, evt_type))
+  {
+    glfwGetCursorPos(window, &x_pos, &y_pos);
+  }
+  else
+  {
+    const bfInputState* const input_state = bfWindow_inputState(w);
 
-  dispatchEvent(w, bfEvent_make(evt_type, 0x0, evt_data));
+    x_pos = input_state->mouse_x;
+    y_pos = input_state->mouse_y;
+  }
+
+  bfMouseEvent evt_data = bfMouseEvent_make((int)(x_pos), (int)(y_pos), target_button, w_glfw->button_state);
+
+  bfPlatformDispatchEvent(w, bfEvent_make(evt_type, 0x0, evt_data));
 }
 
-void GLFW_onWindowFileDropped(GLFWwindow* window, int count, const char** paths)
+static void GLFW_onWindowFileDropped(GLFWwindow* window, int count, const char** paths)
 {
-  // auto& w = getWindow(window);
+  bfWindow* const w                  = getWindow(window);
+  size_t          path_lengths_total = 0u;
+  int             i;
+
+  for (i = 0; i < count; ++i)
+  {
+    path_lengths_total += strlen(paths[i]) + 1u;
+  }
+
+  /*
+    NOTE(SR):
+      GLFW frees the paths once this callback returns so they are copied,
+      the pointer array and every string share a single arena allocation.
+  */
+  const char** const out_paths = bfPlatformFrameAlloc(sizeof(const char*) * (size_t)count + path_lengths_total, sizeof(const char*));
+
+  if (!out_paths)
+  {
+    return;
+  }
+
+  char* out_string = (char*)(out_paths + count);
+
+  for (i = 0; i < count; ++i)
+  {
+    const size_t path_size = strlen(paths[i]) + 1u;
+
+    memcpy(out_string, paths[i], path_size);
+    out_paths[i] = out_string;
+    out_string += path_size;
+  }
+
+  bfFileDropEvent evt_data = bfFileDropEvent_make(out_paths, (size_t)count);
 
-  // w.onFileDrop().safeCall(FileEvent(w, paths, count));
+  bfPlatformDispatchEvent(w, bfEvent_make(BIFROST_EVT_ON_FILE_DROP, 0x0, evt_data));
 }
 
 static void GLFW_onWindowSizeChanged(GLFWwindow* window, int width, int height)
@@ -344,7 +542,7 @@ static void GLFW_onWindowSizeChanged(GLFWwindow* window, int width, int height)
 
   bfWindowEvent evt_data = bfWindowEvent_make(width, height, BIFROST_WINDOW_IS_NONE);
 
-  dispatchEvent(w, bfEvent_make(BIFROST_EVT_ON_WINDOW_RESIZE, 0x0, evt_data));
+  bfPlatformDispatchEvent(w, bfEvent_make(BIFROST_EVT_ON_WINDOW_RESIZE, 0x0, evt_data));
 }
 
 static void GLFW_onWindowRefresh(GLFWwindow* window)
@@ -353,17 +551,62 @@ static void GLFW_onWindowRefresh(GLFWwindow* window)
 
   if (w->frame_fn)
   {
+    bfProfileZoneBegin("bfWindow::frame_fn");
     w->frame_fn(w);
+    bfProfileZoneEnd();
+  }
+}
+
+static size_t encodeUTF8(unsigned int codepoint, char out[4])
+{
+  if (codepoint < 0x80u)
+  {
+    out[0] = (char)codepoint;
+    return 1;
+  }
+
+  if (codepoint < 0x800u)
+  {
+    out[0] = (char)(0xC0u | (codepoint >> 6));
+    out[1] = (char)(0x80u | (codepoint & 0x3Fu));
+    return 2;
+  }
+
+  if (codepoint < 0x10000u)
+  {
+    out[0] = (char)(0xE0u | (codepoint >> 12));
+    out[1] = (char)(0x80u | ((codepoint >> 6) & 0x3Fu));
+    out[2] = (char)(0x80u | (codepoint & 0x3Fu));
+    return 3;
+  }
+
+  if (codepoint < 0x110000u)
+  {
+    out[0] = (char)(0xF0u | (codepoint >> 18));
+    out[1] = (char)(0x80u | ((codepoint >> 12) & 0x3Fu));
+    out[2] = (char)(0x80u | ((codepoint >> 6) & 0x3Fu));
+    out[3] = (char)(0x80u | (codepoint & 0x3Fu));
+    return 4;
   }
+
+  return 0;
 }
 
 static void GLFW_onWindowCharacterInput(GLFWwindow* window, unsigned int codepoint)
 {
   bfWindow* const w = getWindow(window);
 
-  bfKeyboardEvent evt_data = bfKeyboardEvent_makeCodepoint(codepoint);
+  if (BifrostWindowBase_wantsEvent(windowBaseCast(w), BIFROST_EVT_ON_KEY_INPUT))
+  {
+    bfKeyboardEvent evt_data = bfKeyboardEvent_makeCodepoint(codepoint);
+
+    bfPlatformDispatchEvent(w, bfEvent_make(BIFROST_EVT_ON_KEY_INPUT, 0x0, evt_data));
+  }
+
+  char         utf8[4];
+  const size_t utf8_length = encodeUTF8(codepoint, utf8);
 
-  dispatchEvent(w, bfEvent_make(BIFROST_EVT_ON_KEY_INPUT, 0x0, evt_data));
+  bfPlatformDispatchText(w, utf8, utf8_length, bfPlatformTimeNowNs());
 }
 
 static void GLFW_onScrollWheel(GLFWwindow* window, double x_offset, double y_offset)
@@ -372,7 +615,7 @@ static void GLFW_onScrollWheel(GLFWwindow* window, double x_offset, double y_off
 
   bfScrollWheelEvent evt_data = bfScrollWheelEvent_make(x_offset, y_offset);
 
-  dispatchEvent(w, bfEvent_make(BIFROST_EVT_ON_SCROLL_WHEEL, 0x0, evt_data));
+  bfPlatformDispatchEvent(w, bfEvent_make(BIFROST_EVT_ON_SCROLL_WHEEL, 0x0, evt_data));
 }
 
 static void GLFW_onWindowIconify(GLFWwindow* window, int iconified)
@@ -384,7 +627,7 @@ static void GLFW_onWindowIconify(GLFWwindow* window, int iconified)
 
   bfWindowEvent evt_data = bfWindowEvent_make(width, height, iconified == GLFW_TRUE ? BIFROST_WINDOW_IS_MINIMIZED : 0x0);
 
-  dispatchEvent(w, bfEvent_make(BIFROST_EVT_ON_WINDOW_MINIMIZE, 0x0, evt_data));
+  bfPlatformDispatchEvent(w, bfEvent_make(BIFROST_EVT_ON_WINDOW_MINIMIZE, 0x0, evt_data));
 }
 
 void GLFW_onWindowFocusChanged(GLFWwindow* window, int focused)
@@ -396,7 +639,7 @@ void GLFW_onWindowFocusChanged(GLFWwindow* window, int focused)
 
   bfWindowEvent evt_data = bfWindowEvent_make(width, height, focused == GLFW_TRUE ? BIFROST_WINDOW_IS_FOCUSED : 0x0);
 
-  dispatchEvent(w, bfEvent_make(BIFROST_EVT_ON_WINDOW_FOCUS_CHANGED, 0x0, evt_data));
+  bfPlatformDispatchEvent(w, bfEvent_make(BIFROST_EVT_ON_WINDOW_FOCUS_CHANGED, 0x0, evt_data));
 }
 
 static void GLFW_onWindowClose(GLFWwindow* window)
@@ -408,17 +651,45 @@ static void GLFW_onWindowClose(GLFWwindow* window)
 
   bfWindowEvent evt_data = bfWindowEvent_make(width, height, BIFROST_WINDOW_IS_NONE);
 
-  dispatchEvent(w, bfEvent_make(BIFROST_EVT_ON_WINDOW_CLOSE, 0x0, evt_data));
+  bfPlatformDispatchEvent(w, bfEvent_make(BIFROST_EVT_ON_WINDOW_CLOSE, 0x0, evt_data));
 
   // glfwSetWindowShouldClose(window, GLFW_FALSE);
 }
 
+/*!
+ * @brief
+ *   Registers callbacks that only feed events in the window's event mask,
+ *   key, mouse button and scroll callbacks also feed 'bfInputState' and
+ *   iconify / focus feed the main loop's throttling so they stay.
+ */
+static void setMaskableCallbacks(BifrostWindowGLFW* window_glfw)
+{
+  GLFWwindow* const window     = window_glfw->super.super.handle;
+  const uint32_t    event_mask = window_glfw->super.event_mask;
+
+#define BF_WANTS(type) (event_mask & bfEventTypeMask(type))
+
+  glfwSetWindowSizeCallback(window, BF_WANTS(BIFROST_EVT_ON_WINDOW_RESIZE) ? GLFW_onWindowSizeChanged : NULL);
+  glfwSetCharCallback(window, BF_WANTS(BIFROST_EVT_ON_KEY_INPUT) || BF_WANTS(BIFROST_EVT_ON_TEXT_INPUT) ? GLFW_onWindowCharacterInput : NULL);
+  glfwSetWindowCloseCallback(window, BF_WANTS(BIFROST_EVT_ON_WINDOW_CLOSE) ? GLFW_onWindowClose : NULL);
+  glfwSetDropCallback(window, BF_WANTS(BIFROST_EVT_ON_FILE_DROP) ? GLFW_onWindowFileDropped : NULL);
+
+#undef BF_WANTS
+}
+
 bfWindow* bfPlatformCreateWindow(const char* title, int width, int height, uint32_t flags)
 {
-  bfWindow* const window = bfPlatformAlloc(sizeof(bfWindow));
+  BifrostWindowGLFW* const window_glfw = bfPlatformPool_alloc(&s_WindowPool);
+  bfWindow* const          window      = window_glfw ? &window_glfw->super.super : NULL;
 
   if (window)
   {
+    if (!BifrostWindowBase_init(&window_glfw->super))
+    {
+      bfPlatformPool_free(&s_WindowPool, window_glfw);
+      return NULL;
+    }
+
     const int is_opengl = bfPlatformGetGfxAPI() == BIFROST_PLATFORM_GFX_OPENGL;
 
     glfwWindowHint(GLFW_CLIENT_API, is_opengl ? GLFW_OPENGL_API : GLFW_NO_API);
@@ -436,26 +707,34 @@ bfWindow* bfPlatformCreateWindow(const char* title, int width, int height, uint3
     glfwWindowHint(GLFW_COCOA_RETINA_FRAMEBUFFER, GLFW_FALSE);
 #endif
 
+    bfProfileZoneBegin("glfwCreateWindow");
     GLFWwindow* const glfw_handle = glfwCreateWindow(width, height, title, NULL, is_opengl && s_MainWindow ? s_MainWindow->handle : NULL);
+    bfProfileZoneEnd();
 
     window->handle        = glfw_handle;
     window->event_fn      = NULL;
     window->frame_fn      = NULL;
+    window->update_fn     = NULL;
     window->user_data     = NULL;
     window->renderer_data = NULL;
 
+    window_glfw->button_state    = 0x0;
+    window_glfw->super.is_hidden = !(flags & k_bfWindowFlagIsVisible);
+
+    BifrostWindowBase_setFocused(&window_glfw->super, glfwGetWindowAttrib(glfw_handle, GLFW_FOCUSED) == GLFW_TRUE);
+
+    glfwGetCursorPos(glfw_handle, &window_glfw->cursor_x, &window_glfw->cursor_y);
+
     glfwSetWindowUserPointer(glfw_handle, window);
     glfwSetKeyCallback(glfw_handle, GLFW_onKeyChanged);
-    glfwSetCursorPosCallback(glfw_handle, GLFW_onMousePosChanged);
     glfwSetMouseButtonCallback(glfw_handle, GLFW_onMouseButtonChanged);
-    glfwSetDropCallback(glfw_handle, GLFW_onWindowFileDropped);
-    glfwSetWindowSizeCallback(glfw_handle, GLFW_onWindowSizeChanged);
-    glfwSetCharCallback(glfw_handle, GLFW_onWindowCharacterInput);
+    /* NOTE(SR): Never masked out, the motion it dispatches is what keeps 'bfInputState' mouse position and delta current. */
+    glfwSetCursorPosCallback(glfw_handle, GLFW_onMousePosChanged);
     glfwSetScrollCallback(glfw_handle, GLFW_onScrollWheel);
+    glfwSetWindowRefreshCallback(glfw_handle, GLFW_onWindowRefresh);
     glfwSetWindowIconifyCallback(glfw_handle, GLFW_onWindowIconify);
     glfwSetWindowFocusCallback(glfw_handle, GLFW_onWindowFocusChanged);
-    glfwSetWindowCloseCallback(glfw_handle, GLFW_onWindowClose);
-    glfwSetWindowRefreshCallback(glfw_handle, GLFW_onWindowRefresh);
+    setMaskableCallbacks(window_glfw);
 
     // TODO(SR): This should be user configurable.
     glfwSetWindowSizeLimits(glfw_handle, 300, 70, GLFW_DONT_CARE, GLFW_DONT_CARE);
@@ -469,6 +748,30 @@ bfWindow* bfPlatformCreateWindow(const char* title, int width, int height, uint3
   return window;
 }
 
+void bfWindow_setEventMask(bfWindow* self, uint32_t mask)
+{
+  windowBaseCast(self)->event_mask = mask;
+  setMaskableCallbacks(windowCast(self));
+}
+
+void bfWindow_setCursorCaptured(bfWindow* self, int is_captured)
+{
+  BifrostWindowGLFW* const w_glfw = windowCast(self);
+  GLFWwindow* const        handle = self->handle;
+
+  w_glfw->super.is_cursor_captured = is_captured != 0;
+
+  glfwSetInputMode(handle, GLFW_CURSOR, is_captured ? GLFW_CURSOR_DISABLED : GLFW_CURSOR_NORMAL);
+
+  if (glfwRawMouseMotionSupported())
+  {
+    glfwSetInputMode(handle, GLFW_RAW_MOUSE_MOTION, is_captured ? GLFW_TRUE : GLFW_FALSE);
+  }
+
+  /* NOTE(SR): The cursor jumps when the mode changes, that should not show up as motion. */
+  glfwGetCursorPos(handle, &w_glfw->cursor_x, &w_glfw->cursor_y);
+}
+
 int bfWindow_wantsToClose(bfWindow* self)
 {
   return glfwWindowShouldClose(self->handle);
@@ -477,6 +780,7 @@ int bfWindow_wantsToClose(bfWindow* self)
 void bfWindow_show(bfWindow* self)
 {
   glfwShowWindow(self->handle);
+  windowBaseCast(self)->is_hidden = 0;
 }
 
 void bfWindow_getPos(bfWindow* self, int* x, int* y)
@@ -541,12 +845,17 @@ void bfWindow_setAlpha(bfWindow* self, float value)
 
 void bfPlatformDestroyWindow(bfWindow* window)
 {
+  BifrostWindowBase_shutdown(windowBaseCast(window));
+  bfProfileZoneBegin("glfwDestroyWindow");
   glfwDestroyWindow(window->handle);
-  bfPlatformFree(window, sizeof(bfWindow));
+  bfProfileZoneEnd();
+  bfPlatformPool_free(&s_WindowPool, window);
 }
 
 void bfPlatformQuit(void)
 {
+  bfPlatformPool_destroy(&s_WindowPool);
+  bfPlatformShutdownCommon();
   glfwTerminate();
 }
 
@@ -577,8 +886,14 @@ Boolean bfPlatformSetClipboard(bfClipbardDataType type, const char* data, size_t
 {
   assert(type == BF_CLIPBOARD_UTF8_TEXT && "Currently only supported data type.");
 
+  /* NOTE(SR): Not the frame arena, that one is main thread only and this can be called from anywhere. */
   char* const data_nul_terminated = bfPlatformAlloc(data_length + 1);
 
+  if (!data_nul_terminated)
+  {
+    return 0;
+  }
+
   memcpy(data_nul_terminated, data, data_length);
   data_nul_terminated[data_length] = '\0';
 
@@ -608,7 +923,9 @@ GLADloadproc bfPlatformGetProcAddress(void)
 
 void bfWindowGL_swapBuffers(bfWindow* self)
 {
+  bfProfileZoneBegin(__func__);
   glfwSwapBuffers(self->handle);
+  bfProfileZoneEnd();
 }
 
 #if 0
@@ -0,0 +1,253 @@
+/******************************************************************************/
+/*!
+ * @file   bf_platform_internal.h
+ * @author Shareef Abdoul-Raheem (http://blufedora.github.io/)
+ * @brief
+ *   State and helpers shared between the common platform code and the
+ *   windowing backends, not part of the public API.
+ *
+ * @version 0.0.1
+ * @date    2020-07-05
+ *
+ * @copyright Copyright (c) 2020 Shareef Abdoul-Raheem
+ */
+/******************************************************************************/
+#ifndef BF_PLATFORM_INTERNAL_H
+#define BF_PLATFORM_INTERNAL_H
+
+#include "bf/platform/bf_platform.h"
+#include "bf/platform/bf_platform_event.h"
+#include "bf/platform/bf_platform_gamepad.h"
+#include "bf/platform/bf_platform_profile.h"
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h> /* _ReadWriteBarrier, __dmb, _InterlockedExchangeAdd */
+#endif
+
+#if __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief
+ *   Size of a cache line, used to keep data written by different
+ *   threads from sharing a line.
+ */
+#define k_bfPlatformCacheLineSize 64
+
+/*
+  NOTE(SR):
+    Just the two orderings the single producer / single consumer rings need
+    plus an add for handing out slots.
+    MSVC's volatile accesses are already acquire / release on x86 so only the
+    compiler needs fencing there, ARM needs a real barrier.
+*/
+
+static inline size_t bfAtomicLoadAcquire(const size_t* ptr)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+  const size_t value = *(const volatile size_t*)ptr;
+#if defined(_M_ARM) || defined(_M_ARM64)
+  __dmb(0xB /* _ARM64_BARRIER_ISH */);
+#else
+  _ReadWriteBarrier();
+#endif
+  return value;
+#else
+  return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+#endif
+}
+
+static inline void bfAtomicStoreRelease(size_t* ptr, size_t value)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+#if defined(_M_ARM) || defined(_M_ARM64)
+  __dmb(0xB /* _ARM64_BARRIER_ISH */);
+#else
+  _ReadWriteBarrier();
+#endif
+  *(volatile size_t*)ptr = value;
+#else
+  __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+#endif
+}
+
+/* NOTE(SR): Sequentially consistent, returns the value from before the add. */
+static inline size_t bfAtomicFetchAdd(size_t* ptr, size_t value)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+#if defined(_WIN64)
+  return (size_t)_InterlockedExchangeAdd64((volatile __int64*)ptr, (__int64)value);
+#else
+  return (size_t)_InterlockedExchangeAdd((volatile long*)ptr, (long)value);
+#endif
+#else
+  return __atomic_fetch_add(ptr, value, __ATOMIC_SEQ_CST);
+#endif
+}
+
+enum
+{
+  k_bfWindowPendingMouseMove   = (1 << 0),
+  k_bfWindowPendingScrollWheel = (1 << 1),
+  k_bfWindowPendingMouseMotion = (1 << 2),
+  k_bfWindowPendingText        = (1 << 3),
+};
+
+/*!
+ * @brief
+ *   State every backend window needs regardless of the windowing library,
+ *   backend window structs must have this as their first member.
+ */
+typedef struct BifrostWindowBase
+{
+  bfWindow                  super;
+  uint16_t                  index;              /*!< Slot in the window registry, see 'bfWindow_index'.                                             */
+  uint32_t                  event_mask;         /*!< 'bfEventTypeMask' of the events the application wants to receive.                              */
+  uint8_t                   coalesce_flags;     /*!< 'k_bfWindowCoalesce*' flags set by 'bfWindow_setEventCoalescing'.                              */
+  uint8_t                   pending_flags;      /*!< 'k_bfWindowPending*' flags for which pending events below are valid.                           */
+  bfEvent                   pending_move;       /*!< Latest mouse move since the last flush.                                                        */
+  bfEvent                   pending_motion;     /*!< Latest mouse motion since the last flush with the deltas summed.                               */
+  bfEvent                   pending_scroll;     /*!< Sum of all scroll wheel events since the last flush.                                           */
+  bfEvent                   pending_text;       /*!< Text input since the last flush, grown by 'bfPlatformDispatchText'.                            */
+  struct BifrostWindowBase* next_pending;       /*!< Intrusive list of windows that have events waiting to be flushed.                              */
+  bfInputState              input_state[2];     /*!< Current and previous frame input, swapped by 'bfPlatformBeginPumpEvents'.                      */
+  uint8_t                   input_current;      /*!< Index into 'input_state' being written to this frame.                                          */
+  uint8_t                   is_dirty;           /*!< Set when an event is delivered or by 'bfWindow_markDirty', see 'BF_PLATFORM_REDRAW_ON_DEMAND'. */
+  uint8_t                   is_cursor_captured; /*!< Set by 'bfWindow_setCursorCaptured', backends apply it to the OS window.                       */
+  uint8_t                   is_minimized;       /*!< Tracked from 'BIFROST_EVT_ON_WINDOW_MINIMIZE', minimized windows are not drawn.                */
+  uint8_t                   is_hidden;          /*!< Set by the backend while the window is not shown, hidden windows are not drawn.                */
+  uint8_t                   is_focused;         /*!< Tracked from 'BIFROST_EVT_ON_WINDOW_FOCUS_CHANGED', see 'bfPlatformInitParams::background_fps'.  */
+  uint64_t                  frame_period;       /*!< Nanoseconds between frames from 'bfWindow_setFrameRate', 0 to draw every loop.                 */
+  uint64_t                  next_frame_time;    /*!< 'bfPlatformTimeNowNs' the window is next due to be drawn by 'bfPlatformDoMainLoop'.            */
+
+} BifrostWindowBase;
+
+extern bfPlatformInitParams g_BifrostPlatform;
+
+static inline BifrostWindowBase* windowBaseCast(bfWindow* window)
+{
+  return (BifrostWindowBase*)window;
+}
+
+static inline int BifrostWindowBase_wantsEvent(const BifrostWindowBase* self, bfEventType type)
+{
+  return (self->event_mask & bfEventTypeMask(type)) != 0;
+}
+
+/*!
+ * @brief
+ *   Must be called by the backend once the window has been allocated
+ *   and before any events can be dispatched to it.
+ *
+ * @return
+ *   0 (false) - If there are already 'BF_PLATFORM_MAX_WINDOWS' windows alive.
+ *   1 (true)  - The window was registered.
+ */
+BF_PLATFORM_NOAPI int BifrostWindowBase_init(BifrostWindowBase* self);
+
+/*!
+ * @brief
+ *   Backends call this once after creating the OS window with whether it
+ *   starts out focused, after that focus is tracked from focus events.
+ */
+BF_PLATFORM_NOAPI void BifrostWindowBase_setFocused(BifrostWindowBase* self, int is_focused);
+
+/*!
+ * @brief
+ *   Must be called by the backend before the window's memory is freed.
+ */
+BF_PLATFORM_NOAPI void BifrostWindowBase_shutdown(BifrostWindowBase* self);
+
+/*!
+ * @brief
+ *   Routes an event from a backend to the application, either by calling
+ *   'bfWindow::event_fn' directly or by appending it to the event queue
+ *   based on 'bfPlatformInitParams::event_mode'.
+ */
+BF_PLATFORM_NOAPI void bfPlatformDispatchEvent(bfWindow* window, bfEvent event);
+
+/*!
+ * @brief
+ *   Appends to the window's pending 'BIFROST_EVT_ON_TEXT_INPUT' event, the text
+ *   is copied into the 'bfPlatformFrameAlloc' arena so `utf8` does not need to outlive the call.
+ */
+BF_PLATFORM_NOAPI void bfPlatformDispatchText(bfWindow* window, const char* utf8, size_t length, uint64_t timestamp);
+
+/*!
+ * @brief
+ *   Backends must call this at the start of 'bfPlatformPumpEvents'
+ *   before any events are dispatched.
+ */
+BF_PLATFORM_NOAPI void bfPlatformBeginPumpEvents(void);
+
+/*!
+ * @brief
+ *   Backends must call this at the end of 'bfPlatformPumpEvents',
+ *   sends off any events held back for coalescing and then runs
+ *   any 'bfPlatformRunOnMainThread' commands.
+ */
+BF_PLATFORM_NOAPI void bfPlatformEndPumpEvents(void);
+
+/*!
+ * @brief
+ *   The lowest indexed window alive, receives events not tied to any one window.
+ *
+ * @return
+ *   NULL if there are no windows.
+ */
+BF_PLATFORM_NOAPI bfWindow* bfPlatformFirstWindow(void);
+
+/*!
+ * @brief
+ *   Polls the current 'bfGamepadSource' into a fresh 'bfGamepadState'
+ *   and sends connect / disconnect events, called by 'bfPlatformEndPumpEvents'.
+ */
+BF_PLATFORM_NOAPI void bfPlatformUpdateGamepads(void);
+
+/*!
+ * @brief
+ *   Implemented by each backend, where gamepad state is read from
+ *   when the application has not set its own source.
+ */
+BF_PLATFORM_NOAPI bfGamepadSource bfPlatformDefaultGamepadSource(void);
+
+/*!
+ * @brief
+ *   Backends must call this from 'bfPlatformQuit' after freeing their
+ *   own memory, frees memory owned by the common code and then reports
+ *   anything still allocated when built with 'BF_PLATFORM_MEMORY_STATS'.
+ */
+BF_PLATFORM_NOAPI void bfPlatformShutdownCommon(void);
+
+#if __cplusplus
+}
+#endif
+
+#endif /* BF_PLATFORM_INTERNAL_H */
+
+/******************************************************************************/
+/*
+  MIT License
+
+  Copyright (c) 2020 Shareef Abdoul-Raheem
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+/******************************************************************************/
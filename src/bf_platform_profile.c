@@ -0,0 +1,248 @@
+#include "bf_platform_internal.h"
+
+#include "bf/platform/bf_platform_profile.h"
+
+#include <stdio.h> /* FILE, fopen, fprintf */
+
+/*!
+ * @brief
+ *   Number of finished zones each thread can hold between
+ *   calls to 'bfProfileWriteChromeTrace', must be a power of two.
+ */
+#ifndef BF_PLATFORM_PROFILE_BUFFER_SIZE
+#define BF_PLATFORM_PROFILE_BUFFER_SIZE 4096
+#endif
+
+#if (BF_PLATFORM_PROFILE_BUFFER_SIZE & (BF_PLATFORM_PROFILE_BUFFER_SIZE - 1)) != 0
+#error "BF_PLATFORM_PROFILE_BUFFER_SIZE must be a power of two."
+#endif
+
+/*!
+ * @brief
+ *   Number of threads that can record zones, threads past this are ignored.
+ *   A thread gets its slot the first time it records a zone and keeps it
+ *   for the life of the process, slots of exited threads are not reused
+ *   so short lived threads that profile will use these up.
+ */
+#ifndef BF_PLATFORM_PROFILE_MAX_THREADS
+#define BF_PLATFORM_PROFILE_MAX_THREADS 16
+#endif
+
+/*!
+ * @brief
+ *   How deep zones can nest on a single thread, zones deeper than
+ *   this are not recorded but still have to be ended.
+ */
+#ifndef BF_PLATFORM_PROFILE_MAX_DEPTH
+#define BF_PLATFORM_PROFILE_MAX_DEPTH 64
+#endif
+
+#if BF_PLATFORM_PROFILE
+
+#if defined(_MSC_VER)
+#define bfThreadLocal __declspec(thread)
+#else
+#define bfThreadLocal __thread
+#endif
+
+typedef struct
+{
+  const char* name;
+  uint64_t    begin_ticks; /*!< 'bfPlatformTicks' at 'bfProfileRecordBegin'. */
+  uint64_t    end_ticks;   /*!< 'bfPlatformTicks' at 'bfProfileRecordEnd'.   */
+
+} bfProfileRecord;
+
+/*
+  NOTE(SR):
+    Same single producer / single consumer layout as the event queue,
+    the owning thread writes 'tail' and the exporter writes 'head'.
+    Zones are only written once they end so a full ring drops whole
+    zones and the export never has a begin without its end.
+*/
+
+typedef struct
+{
+  bfProfileRecord records[BF_PLATFORM_PROFILE_BUFFER_SIZE];
+  size_t          head; /*!< Index of the next record to be exported, only ever incremented. */
+  char            head_padding[k_bfPlatformCacheLineSize - sizeof(size_t)];
+  size_t          tail; /*!< Index of the next record to be written, only ever incremented. */
+  char            tail_padding[k_bfPlatformCacheLineSize - sizeof(size_t)];
+
+} bfProfileBuffer;
+
+static bfProfileBuffer                s_ProfileBuffers[BF_PLATFORM_PROFILE_MAX_THREADS];
+static size_t                         s_ProfileNumBuffers        = 0u; /*!< Slots handed out, may go past the max. */
+static bfThreadLocal bfProfileBuffer* t_ProfileBuffer            = NULL;
+static bfThreadLocal int              t_ProfileHasAskedForBuffer = 0;
+static bfThreadLocal bfProfileRecord  t_ProfileOpenZones[BF_PLATFORM_PROFILE_MAX_DEPTH];
+static bfThreadLocal size_t           t_ProfileDepth = 0u; /*!< Number of open zones, may go past the max. */
+
+static bfProfileBuffer* threadBuffer(void)
+{
+  if (!t_ProfileHasAskedForBuffer)
+  {
+    const size_t index = bfAtomicFetchAdd(&s_ProfileNumBuffers, 1u);
+
+    t_ProfileBuffer            = index < BF_PLATFORM_PROFILE_MAX_THREADS ? &s_ProfileBuffers[index] : NULL;
+    t_ProfileHasAskedForBuffer = 1;
+  }
+
+  return t_ProfileBuffer;
+}
+
+static void recordZone(const bfProfileRecord* zone)
+{
+  bfProfileBuffer* const buffer = threadBuffer();
+
+  if (buffer)
+  {
+    const size_t tail = buffer->tail;
+
+    if (tail - bfAtomicLoadAcquire(&buffer->head) < BF_PLATFORM_PROFILE_BUFFER_SIZE)
+    {
+      buffer->records[tail & (BF_PLATFORM_PROFILE_BUFFER_SIZE - 1)] = *zone;
+
+      bfAtomicStoreRelease(&buffer->tail, tail + 1);
+    }
+  }
+}
+
+static void writeJSONString(FILE* file, const char* str)
+{
+  fputc('"', file);
+
+  for (; *str; ++str)
+  {
+    if (*str == '"' || *str == '\\')
+    {
+      fputc('\\', file);
+      fputc(*str, file);
+    }
+    else if ((unsigned char)*str >= 0x20u)
+    {
+      fputc(*str, file);
+    }
+  }
+
+  fputc('"', file);
+}
+
+void bfProfileRecordBegin(const char* name)
+{
+  if (t_ProfileDepth < BF_PLATFORM_PROFILE_MAX_DEPTH)
+  {
+    bfProfileRecord* const zone = &t_ProfileOpenZones[t_ProfileDepth];
+
+    zone->name        = name;
+    zone->begin_ticks = bfPlatformTicks();
+  }
+
+  ++t_ProfileDepth;
+}
+
+void bfProfileRecordEnd(void)
+{
+  if (t_ProfileDepth == 0u)
+  {
+    return;
+  }
+
+  if (--t_ProfileDepth < BF_PLATFORM_PROFILE_MAX_DEPTH)
+  {
+    bfProfileRecord* const zone = &t_ProfileOpenZones[t_ProfileDepth];
+
+    zone->end_ticks = bfPlatformTicks();
+    recordZone(zone);
+  }
+}
+
+int bfProfileWriteChromeTrace(const char* file_path)
+{
+  FILE* const  file          = fopen(file_path, "w");
+  const double ticks_to_us   = 1000000.0 / (double)bfPlatformTickFrequency();
+  const size_t num_buffers   = bfAtomicLoadAcquire(&s_ProfileNumBuffers);
+  const size_t num_to_export = num_buffers < BF_PLATFORM_PROFILE_MAX_THREADS ? num_buffers : BF_PLATFORM_PROFILE_MAX_THREADS;
+  const char*  separator     = "\n";
+  size_t       thread_index;
+
+  if (!file)
+  {
+    return 0;
+  }
+
+  fputs("{\"traceEvents\":[", file);
+
+  for (thread_index = 0; thread_index < num_to_export; ++thread_index)
+  {
+    bfProfileBuffer* const buffer = &s_ProfileBuffers[thread_index];
+    const size_t           tail   = bfAtomicLoadAcquire(&buffer->tail);
+    size_t                 i;
+
+    for (i = buffer->head; i != tail; ++i)
+    {
+      const bfProfileRecord* const record = &buffer->records[i & (BF_PLATFORM_PROFILE_BUFFER_SIZE - 1)];
+
+      fputs(separator, file);
+      fputs("{\"name\":", file);
+      writeJSONString(file, record->name);
+      fprintf(file,
+              ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+              (double)record->begin_ticks * ticks_to_us,
+              (double)(record->end_ticks - record->begin_ticks) * ticks_to_us,
+              (unsigned)thread_index);
+      separator = ",\n";
+    }
+
+    bfAtomicStoreRelease(&buffer->head, tail);
+  }
+
+  fputs("\n]}\n", file);
+
+  return fclose(file) == 0;
+}
+
+#else
+
+void bfProfileRecordBegin(const char* name)
+{
+  (void)name;
+}
+
+void bfProfileRecordEnd(void)
+{
+}
+
+int bfProfileWriteChromeTrace(const char* file_path)
+{
+  (void)file_path;
+  return 0;
+}
+
+#endif
+
+/******************************************************************************/
+/*
+  MIT License
+
+  Copyright (c) 2020 Shareef Abdoul-Raheem
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+/******************************************************************************/
@@ -1,13 +1,13 @@
-#include "bf/platform/bf_platform.h"
+#include "bf_platform_internal.h"
 
-#include "bf/platform/bf_platform_event.h"
 #include "bf/platform/bf_platform_gl.h"
 #include "bf/platform/bf_platform_vulkan.h"
 
 #include <sdl/SDL.h>        /* SDL_* */
 #include <sdl/SDL_vulkan.h> /* SDL_Vulkan_CreateSurface */
 
-#include <assert.h> /* assert */
+#include <assert.h> /* assert  */
+#include <limits.h> /* INT_MAX */
 
 #if BIFROST_PLATFORM_EMSCRIPTEN
 #include <emscripten/emscripten.h>
@@ -18,8 +18,6 @@ typedef SDL_Window* NativeWindowHandle;
 
 #define EMSCRIPTEN_CANVAS_NAME "#canvas"
 
-extern bfPlatformInitParams g_BifrostPlatform;
-
 #if BIFROST_PLATFORM_EMSCRIPTEN
 /*static*/ EMSCRIPTEN_WEBGL_CONTEXT_HANDLE g_CanvasContext = 0;
 #endif
@@ -31,6 +29,20 @@ extern bfPlatformInitParams g_BifrostPlatform;
 
 static const char* const k_bfWindowUserStorageID = "bf.BifrostWindowSDL";
 
+/*!
+ * @brief
+ *   'bfPlatformTimeNowNs' at the point 'SDL_GetTicks' was zero, SDL event
+ *   timestamps are in milliseconds since then so this puts them on our clock.
+ */
+static uint64_t s_TicksEpoch = 0u;
+
+/*!
+ * @brief
+ *   Registered with 'SDL_RegisterEvents', pushed by 'bfPlatformWakeUp'
+ *   only to make 'SDL_WaitEvent' return.
+ */
+static Uint32 s_WakeUpEventType = (Uint32)-1;
+
 // TODO(SR):
 //   - SDL_GL_CreateContext
 //   - SDL_GL_SetAttribute(SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 1);
@@ -39,14 +51,34 @@ static const char* const k_bfWindowUserStorageID = "bf.BifrostWindowSDL";
 //   - SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
 //   - SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 2);
 
+/*!
+ * @brief
+ *   A path from 'SDL_DROPFILE' copied into the platform heap, linked
+ *   together until 'SDL_DROPCOMPLETE'. Not the per pump arena since
+ *   a drop is not guaranteed to arrive within a single pump.
+ */
+typedef struct DroppedPath
+{
+  struct DroppedPath* next;
+  size_t              path_size; /*!< Includes the nul terminator. */
+  char                path[];
+
+} DroppedPath;
+
 typedef struct
 {
-  bfWindow super;
-  void*         gl_context;
-  int           wants_to_close;
+  BifrostWindowBase super;
+  void*             gl_context;
+  int               wants_to_close;
+  bfButtonFlags     button_state;
+  DroppedPath*      drop_head;  /*!< Paths received since the last 'SDL_DROPBEGIN'. */
+  DroppedPath**     drop_tail;  /*!< Where to link the next dropped path.          */
+  size_t            drop_count; /*!< Number of nodes in 'drop_head'.                */
 
 } BifrostWindowSDL;
 
+static bfPlatformPool s_WindowPool; /*!< Every 'BifrostWindowSDL' is allocated from here so live windows sit next to each other. */
+
 static BifrostWindowSDL* windowCast(bfWindow* window)
 {
   return (BifrostWindowSDL*)window;
@@ -54,71 +86,745 @@ static BifrostWindowSDL* windowCast(bfWindow* window)
 
 int bfPlatformInit(bfPlatformInitParams params)
 {
-  const int was_success = SDL_Init(SDL_INIT_VIDEO) == 0;
+  const int was_success = SDL_Init(SDL_INIT_VIDEO | SDL_INIT_GAMECONTROLLER) == 0;
 
   if (was_success)
   {
     g_BifrostPlatform = params;
+    s_TicksEpoch      = bfPlatformTimeNowNs() - (uint64_t)SDL_GetTicks() * 1000000u;
+    s_WakeUpEventType = SDL_RegisterEvents(1);
 
     if (!g_BifrostPlatform.allocator)
     {
       g_BifrostPlatform.allocator = &bfPlatformDefaultAllocator;
+
+      if (!g_BifrostPlatform.aligned_allocator)
+      {
+        g_BifrostPlatform.aligned_allocator = &bfPlatformDefaultAlignedAllocator;
+      }
     }
+
+    bfPlatformPool_init(&s_WindowPool, sizeof(BifrostWindowSDL), 0u);
+    s_WindowPool.tag = BF_PLATFORM_MEMORY_TAG_WINDOW;
   }
 
   return was_success;
 }
 
-#include <stdio.h>
+static BifrostWindowSDL* getWindow(Uint32 window_id)
+{
+  SDL_Window* const sdl_window = SDL_GetWindowFromID(window_id);
+
+  return sdl_window ? SDL_GetWindowData(sdl_window, k_bfWindowUserStorageID) : NULL;
+}
+
+/*
+  NOTE(SR):
+    SDL timestamps only have millisecond resolution so one converted from the
+    current millisecond can land up to 1ms in the future, clamped so an event
+    is never stamped later than when it was read.
+*/
+static uint64_t convertTimestamp(Uint32 timestamp)
+{
+  const uint64_t converted = s_TicksEpoch + (uint64_t)timestamp * 1000000u;
+  const uint64_t now       = bfPlatformTimeNowNs();
+
+  return converted < now ? converted : now;
+}
+
+static bfKeyModifiers convertKeyModifiers(Uint16 mods)
+{
+  bfKeyModifiers result = 0x0;
+
+  if (mods & KMOD_SHIFT)
+  {
+    result |= BIFROST_KEY_FLAG_SHIFT;
+  }
+
+  if (mods & KMOD_CTRL)
+  {
+    result |= BIFROST_KEY_FLAG_CONTROL;
+  }
+
+  if (mods & KMOD_ALT)
+  {
+    result |= BIFROST_KEY_FLAG_ALT;
+  }
+
+  if (mods & KMOD_GUI)
+  {
+    result |= BIFROST_KEY_FLAG_SUPER;
+  }
+
+  if (mods & KMOD_CAPS)
+  {
+    result |= BIFROST_KEY_FLAG_IS_CAPS_LOCKED;
+  }
+
+  if (mods & KMOD_NUM)
+  {
+    result |= BIFROST_KEY_FLAG_IS_NUM_LOCKED;
+  }
+
+  return result;
+}
+
+/*
+  NOTE(SR):
+    Physical scancodes are used rather than 'SDL_Keycode' since they
+    are dense and match GLFW's layout independent key codes,
+    any scancode not listed is 'BIFROST_KEY_UNKNOWN' (0).
+*/
+// clang-format off
+static const int16_t k_SDLScancodeToBifrostKey[SDL_NUM_SCANCODES] =
+{
+  [SDL_SCANCODE_SPACE]        = BIFROST_KEY_SPACE,
+  [SDL_SCANCODE_APOSTROPHE]   = BIFROST_KEY_APOSTROPHE,
+  [SDL_SCANCODE_COMMA]        = BIFROST_KEY_COMMA,
+  [SDL_SCANCODE_MINUS]        = BIFROST_KEY_MINUS,
+  [SDL_SCANCODE_PERIOD]       = BIFROST_KEY_PERIOD,
+  [SDL_SCANCODE_SLASH]        = BIFROST_KEY_SLASH,
+  [SDL_SCANCODE_0]            = BIFROST_KEY_0,
+  [SDL_SCANCODE_1]            = BIFROST_KEY_1,
+  [SDL_SCANCODE_2]            = BIFROST_KEY_2,
+  [SDL_SCANCODE_3]            = BIFROST_KEY_3,
+  [SDL_SCANCODE_4]            = BIFROST_KEY_4,
+  [SDL_SCANCODE_5]            = BIFROST_KEY_5,
+  [SDL_SCANCODE_6]            = BIFROST_KEY_6,
+  [SDL_SCANCODE_7]            = BIFROST_KEY_7,
+  [SDL_SCANCODE_8]            = BIFROST_KEY_8,
+  [SDL_SCANCODE_9]            = BIFROST_KEY_9,
+  [SDL_SCANCODE_SEMICOLON]    = BIFROST_KEY_SEMICOLON,
+  [SDL_SCANCODE_EQUALS]       = BIFROST_KEY_EQUAL,
+  [SDL_SCANCODE_A]            = BIFROST_KEY_A,
+  [SDL_SCANCODE_B]            = BIFROST_KEY_B,
+  [SDL_SCANCODE_C]            = BIFROST_KEY_C,
+  [SDL_SCANCODE_D]            = BIFROST_KEY_D,
+  [SDL_SCANCODE_E]            = BIFROST_KEY_E,
+  [SDL_SCANCODE_F]            = BIFROST_KEY_F,
+  [SDL_SCANCODE_G]            = BIFROST_KEY_G,
+  [SDL_SCANCODE_H]            = BIFROST_KEY_H,
+  [SDL_SCANCODE_I]            = BIFROST_KEY_I,
+  [SDL_SCANCODE_J]            = BIFROST_KEY_J,
+  [SDL_SCANCODE_K]            = BIFROST_KEY_K,
+  [SDL_SCANCODE_L]            = BIFROST_KEY_L,
+  [SDL_SCANCODE_M]            = BIFROST_KEY_M,
+  [SDL_SCANCODE_N]            = BIFROST_KEY_N,
+  [SDL_SCANCODE_O]            = BIFROST_KEY_O,
+  [SDL_SCANCODE_P]            = BIFROST_KEY_P,
+  [SDL_SCANCODE_Q]            = BIFROST_KEY_Q,
+  [SDL_SCANCODE_R]            = BIFROST_KEY_R,
+  [SDL_SCANCODE_S]            = BIFROST_KEY_S,
+  [SDL_SCANCODE_T]            = BIFROST_KEY_T,
+  [SDL_SCANCODE_U]            = BIFROST_KEY_U,
+  [SDL_SCANCODE_V]            = BIFROST_KEY_V,
+  [SDL_SCANCODE_W]            = BIFROST_KEY_W,
+  [SDL_SCANCODE_X]            = BIFROST_KEY_X,
+  [SDL_SCANCODE_Y]            = BIFROST_KEY_Y,
+  [SDL_SCANCODE_Z]            = BIFROST_KEY_Z,
+  [SDL_SCANCODE_LEFTBRACKET]  = BIFROST_KEY_LEFT_BRACKET,
+  [SDL_SCANCODE_BACKSLASH]    = BIFROST_KEY_BACKSLASH,
+  [SDL_SCANCODE_RIGHTBRACKET] = BIFROST_KEY_RIGHT_BRACKET,
+  [SDL_SCANCODE_GRAVE]        = BIFROST_KEY_GRAVE_ACCENT,
+  [SDL_SCANCODE_ESCAPE]       = BIFROST_KEY_ESCAPE,
+  [SDL_SCANCODE_RETURN]       = BIFROST_KEY_ENTER,
+  [SDL_SCANCODE_TAB]          = BIFROST_KEY_TAB,
+  [SDL_SCANCODE_BACKSPACE]    = BIFROST_KEY_BACKSPACE,
+  [SDL_SCANCODE_INSERT]       = BIFROST_KEY_INSERT,
+  [SDL_SCANCODE_DELETE]       = BIFROST_KEY_DELETE,
+  [SDL_SCANCODE_RIGHT]        = BIFROST_KEY_RIGHT,
+  [SDL_SCANCODE_LEFT]         = BIFROST_KEY_LEFT,
+  [SDL_SCANCODE_DOWN]         = BIFROST_KEY_DOWN,
+  [SDL_SCANCODE_UP]           = BIFROST_KEY_UP,
+  [SDL_SCANCODE_PAGEUP]       = BIFROST_KEY_PAGE_UP,
+  [SDL_SCANCODE_PAGEDOWN]     = BIFROST_KEY_PAGE_DOWN,
+  [SDL_SCANCODE_HOME]         = BIFROST_KEY_HOME,
+  [SDL_SCANCODE_END]          = BIFROST_KEY_END,
+  [SDL_SCANCODE_CAPSLOCK]     = BIFROST_KEY_CAPS_LOCK,
+  [SDL_SCANCODE_SCROLLLOCK]   = BIFROST_KEY_SCROLL_LOCK,
+  [SDL_SCANCODE_NUMLOCKCLEAR] = BIFROST_KEY_NUM_LOCK,
+  [SDL_SCANCODE_PRINTSCREEN]  = BIFROST_KEY_PRINT_SCREEN,
+  [SDL_SCANCODE_PAUSE]        = BIFROST_KEY_PAUSE,
+  [SDL_SCANCODE_F1]           = BIFROST_KEY_F1,
+  [SDL_SCANCODE_F2]           = BIFROST_KEY_F2,
+  [SDL_SCANCODE_F3]           = BIFROST_KEY_F3,
+  [SDL_SCANCODE_F4]           = BIFROST_KEY_F4,
+  [SDL_SCANCODE_F5]           = BIFROST_KEY_F5,
+  [SDL_SCANCODE_F6]           = BIFROST_KEY_F6,
+  [SDL_SCANCODE_F7]           = BIFROST_KEY_F7,
+  [SDL_SCANCODE_F8]           = BIFROST_KEY_F8,
+  [SDL_SCANCODE_F9]           = BIFROST_KEY_F9,
+  [SDL_SCANCODE_F10]          = BIFROST_KEY_F10,
+  [SDL_SCANCODE_F11]          = BIFROST_KEY_F11,
+  [SDL_SCANCODE_F12]          = BIFROST_KEY_F12,
+  [SDL_SCANCODE_F13]          = BIFROST_KEY_F13,
+  [SDL_SCANCODE_F14]          = BIFROST_KEY_F14,
+  [SDL_SCANCODE_F15]          = BIFROST_KEY_F15,
+  [SDL_SCANCODE_F16]          = BIFROST_KEY_F16,
+  [SDL_SCANCODE_F17]          = BIFROST_KEY_F17,
+  [SDL_SCANCODE_F18]          = BIFROST_KEY_F18,
+  [SDL_SCANCODE_F19]          = BIFROST_KEY_F19,
+  [SDL_SCANCODE_F20]          = BIFROST_KEY_F20,
+  [SDL_SCANCODE_F21]          = BIFROST_KEY_F21,
+  [SDL_SCANCODE_F22]          = BIFROST_KEY_F22,
+  [SDL_SCANCODE_F23]          = BIFROST_KEY_F23,
+  [SDL_SCANCODE_F24]          = BIFROST_KEY_F24,
+  [SDL_SCANCODE_KP_0]         = BIFROST_KEY_PAD_0,
+  [SDL_SCANCODE_KP_1]         = BIFROST_KEY_PAD_1,
+  [SDL_SCANCODE_KP_2]         = BIFROST_KEY_PAD_2,
+  [SDL_SCANCODE_KP_3]         = BIFROST_KEY_PAD_3,
+  [SDL_SCANCODE_KP_4]         = BIFROST_KEY_PAD_4,
+  [SDL_SCANCODE_KP_5]         = BIFROST_KEY_PAD_5,
+  [SDL_SCANCODE_KP_6]         = BIFROST_KEY_PAD_6,
+  [SDL_SCANCODE_KP_7]         = BIFROST_KEY_PAD_7,
+  [SDL_SCANCODE_KP_8]         = BIFROST_KEY_PAD_8,
+  [SDL_SCANCODE_KP_9]         = BIFROST_KEY_PAD_9,
+  [SDL_SCANCODE_KP_PERIOD]    = BIFROST_KEY_PAD_DECIMAL,
+  [SDL_SCANCODE_KP_DIVIDE]    = BIFROST_KEY_PAD_DIVIDE,
+  [SDL_SCANCODE_KP_MULTIPLY]  = BIFROST_KEY_PAD_MULTIPLY,
+  [SDL_SCANCODE_KP_MINUS]     = BIFROST_KEY_PAD_SUBTRACT,
+  [SDL_SCANCODE_KP_PLUS]      = BIFROST_KEY_PAD_ADD,
+  [SDL_SCANCODE_KP_ENTER]     = BIFROST_KEY_PAD_ENTER,
+  [SDL_SCANCODE_KP_EQUALS]    = BIFROST_KEY_PAD_EQUAL,
+  [SDL_SCANCODE_LSHIFT]       = BIFROST_KEY_LEFT_SHIFT,
+  [SDL_SCANCODE_LCTRL]        = BIFROST_KEY_LEFT_CONTROL,
+  [SDL_SCANCODE_LALT]         = BIFROST_KEY_LEFT_ALT,
+  [SDL_SCANCODE_LGUI]         = BIFROST_KEY_LEFT_SUPER,
+  [SDL_SCANCODE_RSHIFT]       = BIFROST_KEY_RIGHT_SHIFT,
+  [SDL_SCANCODE_RCTRL]        = BIFROST_KEY_RIGHT_CONTROL,
+  [SDL_SCANCODE_RALT]         = BIFROST_KEY_RIGHT_ALT,
+  [SDL_SCANCODE_RGUI]         = BIFROST_KEY_RIGHT_SUPER,
+  [SDL_SCANCODE_APPLICATION]  = BIFROST_KEY_MENU,
+};
+// clang-format on
+
+static int convertKey(SDL_Scancode scancode)
+{
+  return k_SDLScancodeToBifrostKey[scancode & (SDL_NUM_SCANCODES - 1)];
+}
 
-static void dispatchEvent(bfWindow* window, bfEvent event)
+static uint8_t convertButton(Uint8 button)
 {
-  if (window->event_fn)
+  switch (button)
   {
-    event.receiver = window;
-    window->event_fn(window, &event);
+    case SDL_BUTTON_LEFT: return BIFROST_BUTTON_LEFT;
+    case SDL_BUTTON_MIDDLE: return BIFROST_BUTTON_MIDDLE;
+    case SDL_BUTTON_RIGHT: return BIFROST_BUTTON_RIGHT;
+    case SDL_BUTTON_X1: return BIFROST_BUTTON_EXTRA0;
+    case SDL_BUTTON_X2: return BIFROST_BUTTON_EXTRA1;
+    default: return (uint8_t)BIFROST_BUTTON_NONE;
   }
 }
 
-void bfPlatformPumpEvents(void)
+static bfButtonFlags convertButtonState(Uint32 state)
 {
-  SDL_Event evt;
+  bfButtonFlags result = 0x0;
 
-  while (SDL_PollEvent(&evt))
+  if (state & SDL_BUTTON_LMASK)
+  {
+    result |= BIFROST_BUTTON_LEFT;
+  }
+
+  if (state & SDL_BUTTON_MMASK)
+  {
+    result |= BIFROST_BUTTON_MIDDLE;
+  }
+
+  if (state & SDL_BUTTON_RMASK)
+  {
+    result |= BIFROST_BUTTON_RIGHT;
+  }
+
+  if (state & SDL_BUTTON_X1MASK)
+  {
+    result |= BIFROST_BUTTON_EXTRA0;
+  }
+
+  if (state & SDL_BUTTON_X2MASK)
+  {
+    result |= BIFROST_BUTTON_EXTRA1;
+  }
+
+  return result;
+}
+
+static void dispatchTimestampedEvent(BifrostWindowSDL* window, bfEvent event, Uint32 timestamp)
+{
+  event.timestamp = convertTimestamp(timestamp);
+  bfPlatformDispatchEvent(&window->super.super, event);
+}
+
+static void dispatchWindowEvent(BifrostWindowSDL* window, bfEventType type, bfWindowFlags state, Uint32 timestamp)
+{
+  /* NOTE(SR): Minimize / focus always go through, they feed the main loop's throttling and 'bfPlatformDispatchEvent' applies the mask after. */
+  const int tracks_state = type == BIFROST_EVT_ON_WINDOW_MINIMIZE || type == BIFROST_EVT_ON_WINDOW_FOCUS_CHANGED;
+
+  if (!tracks_state && !BifrostWindowBase_wantsEvent(&window->super, type))
+  {
+    return;
+  }
+
+  int width, height;
+  SDL_GetWindowSize((NativeWindowHandle)window->super.super.handle, &width, &height);
+
+  bfWindowEvent evt_data = bfWindowEvent_make(width, height, state);
+
+  dispatchTimestampedEvent(window, bfEvent_make(type, 0x0, evt_data), timestamp);
+}
+
+/* Gamepads */
+
+/*!
+ * @brief
+ *   Opened controllers by 'bfGamepadState' index, filled in as
+ *   'SDL_CONTROLLERDEVICEADDED' / 'SDL_CONTROLLERDEVICEREMOVED' come in.
+ */
+static SDL_GameController* s_GameControllers[k_bfGamepadMax];
+
+static const SDL_GameControllerButton k_BifrostToSDLGamepadButton[BIFROST_GAMEPAD_BUTTON_MAX] =
+{
+  SDL_CONTROLLER_BUTTON_A,
+  SDL_CONTROLLER_BUTTON_B,
+  SDL_CONTROLLER_BUTTON_X,
+  SDL_CONTROLLER_BUTTON_Y,
+  SDL_CONTROLLER_BUTTON_LEFTSHOULDER,
+  SDL_CONTROLLER_BUTTON_RIGHTSHOULDER,
+  SDL_CONTROLLER_BUTTON_BACK,
+  SDL_CONTROLLER_BUTTON_START,
+  SDL_CONTROLLER_BUTTON_GUIDE,
+  SDL_CONTROLLER_BUTTON_LEFTSTICK,
+  SDL_CONTROLLER_BUTTON_RIGHTSTICK,
+  SDL_CONTROLLER_BUTTON_DPAD_UP,
+  SDL_CONTROLLER_BUTTON_DPAD_RIGHT,
+  SDL_CONTROLLER_BUTTON_DPAD_DOWN,
+  SDL_CONTROLLER_BUTTON_DPAD_LEFT,
+};
+
+static void openGameController(int device_index)
+{
+  int i;
+
+  /* NOTE(SR): Devices present at startup are reported again once the event loop runs. */
+  if (SDL_GameControllerFromInstanceID(SDL_JoystickGetDeviceInstanceID(device_index)))
+  {
+    return;
+  }
+
+  for (i = 0; i < k_bfGamepadMax; ++i)
+  {
+    if (!s_GameControllers[i])
+    {
+      s_GameControllers[i] = SDL_GameControllerOpen(device_index);
+      return;
+    }
+  }
+}
+
+static void closeGameController(SDL_JoystickID instance_id)
+{
+  int i;
+
+  for (i = 0; i < k_bfGamepadMax; ++i)
+  {
+    if (s_GameControllers[i] && SDL_JoystickInstanceID(SDL_GameControllerGetJoystick(s_GameControllers[i])) == instance_id)
+    {
+      SDL_GameControllerClose(s_GameControllers[i]);
+      s_GameControllers[i] = NULL;
+      return;
+    }
+  }
+}
+
+static int SDL_pollGamepad(void* user_data, int index, bfGamepadRawState* out)
+{
+  SDL_GameController* const controller = s_GameControllers[index];
+  int                       i;
+
+  (void)user_data;
+
+  if (!controller)
+  {
+    return 0;
+  }
+
+  out->buttons = 0x0;
+
+  for (i = 0; i < BIFROST_GAMEPAD_BUTTON_MAX; ++i)
+  {
+    out->buttons |= (uint32_t)(SDL_GameControllerGetButton(controller, k_BifrostToSDLGamepadButton[i]) != 0) << i;
+  }
+
+  /* NOTE(SR): The axes are already in the same order, sticks go down to -32768 so they get clamped. */
+  for (i = 0; i < BIFROST_GAMEPAD_AXIS_MAX; ++i)
+  {
+    const float value = (float)SDL_GameControllerGetAxis(controller, (SDL_GameControllerAxis)i) * (1.0f / 32767.0f);
+
+    out->axes[i] = value < -1.0f ? -1.0f : value;
+  }
+
+  return 1;
+}
+
+static const char* SDL_gamepadName(void* user_data, int index)
+{
+  (void)user_data;
+
+  return s_GameControllers[index] ? SDL_GameControllerName(s_GameControllers[index]) : NULL;
+}
+
+bfGamepadSource bfPlatformDefaultGamepadSource(void)
+{
+  bfGamepadSource self;
+  self.user_data = NULL;
+  self.poll      = &SDL_pollGamepad;
+  self.name      = &SDL_gamepadName;
+
+  return self;
+}
+
+static void resetDroppedPaths(BifrostWindowSDL* window)
+{
+  window->drop_head  = NULL;
+  window->drop_tail  = &window->drop_head;
+  window->drop_count = 0u;
+}
+
+static void freeDroppedPaths(BifrostWindowSDL* window)
+{
+  DroppedPath* node = window->drop_head;
+
+  while (node)
+  {
+    DroppedPath* const next = node->next;
+
+    bfPlatformFree(node, sizeof(DroppedPath) + node->path_size);
+    node = next;
+  }
+
+  resetDroppedPaths(window);
+}
+
+static void processEvent(const SDL_Event* evt)
+{
+  switch (evt->type)
   {
-    switch (evt.type)
+    case SDL_WINDOWEVENT:
+    {
+      const SDL_WindowEvent* const window_evt = &evt->window;
+      BifrostWindowSDL* const      bf_window  = getWindow(window_evt->windowID);
+
+      if (!bf_window)
+      {
+        break;
+      }
+
+      // [https://wiki.libsdl.org/SDL_WindowEvent]
+      switch (window_evt->event)
+      {
+        case SDL_WINDOWEVENT_CLOSE:
+        {
+          bf_window->wants_to_close = bfTrue;
+          dispatchWindowEvent(bf_window, BIFROST_EVT_ON_WINDOW_CLOSE, BIFROST_WINDOW_IS_NONE, window_evt->timestamp);
+          break;
+        }
+        case SDL_WINDOWEVENT_SIZE_CHANGED:
+        {
+          dispatchWindowEvent(bf_window, BIFROST_EVT_ON_WINDOW_RESIZE, BIFROST_WINDOW_IS_NONE, window_evt->timestamp);
+          break;
+        }
+        case SDL_WINDOWEVENT_MINIMIZED:
+        {
+          dispatchWindowEvent(bf_window, BIFROST_EVT_ON_WINDOW_MINIMIZE, BIFROST_WINDOW_IS_MINIMIZED, window_evt->timestamp);
+          break;
+        }
+        case SDL_WINDOWEVENT_RESTORED:
+        {
+          dispatchWindowEvent(bf_window, BIFROST_EVT_ON_WINDOW_MINIMIZE, BIFROST_WINDOW_IS_NONE, window_evt->timestamp);
+          break;
+        }
+        case SDL_WINDOWEVENT_FOCUS_GAINED:
+        {
+          dispatchWindowEvent(bf_window, BIFROST_EVT_ON_WINDOW_FOCUS_CHANGED, BIFROST_WINDOW_IS_FOCUSED, window_evt->timestamp);
+          break;
+        }
+        case SDL_WINDOWEVENT_FOCUS_LOST:
+        {
+          dispatchWindowEvent(bf_window, BIFROST_EVT_ON_WINDOW_FOCUS_CHANGED, BIFROST_WINDOW_IS_NONE, window_evt->timestamp);
+          break;
+        }
+        case SDL_WINDOWEVENT_SHOWN:
+        case SDL_WINDOWEVENT_HIDDEN:
+        {
+          bf_window->super.is_hidden = window_evt->event == SDL_WINDOWEVENT_HIDDEN;
+          break;
+        }
+      }
+
+      break;
+    }
+    case SDL_KEYDOWN:
+    case SDL_KEYUP:
+    {
+      BifrostWindowSDL* const bf_window     = getWindow(evt->key.windowID);
+      const int               converted_key = convertKey(evt->key.keysym.scancode);
+
+      if (bf_window && converted_key != BIFROST_KEY_UNKNOWN)
+      {
+        const bfEventType evt_type = evt->type == SDL_KEYUP ? BIFROST_EVT_ON_KEY_UP : evt->key.repeat ? BIFROST_EVT_ON_KEY_HELD : BIFROST_EVT_ON_KEY_DOWN;
+
+        /* NOTE(SR): Repeats do not change 'bfInputState' so can be dropped early. */
+        if (evt_type == BIFROST_EVT_ON_KEY_HELD && !BifrostWindowBase_wantsEvent(&bf_window->super, evt_type))
+        {
+          break;
+        }
+
+        bfKeyboardEvent evt_data = bfKeyboardEvent_makeKeyMod(converted_key, convertKeyModifiers(evt->key.keysym.mod));
+
+        dispatchTimestampedEvent(bf_window, bfEvent_make(evt_type, 0x0, evt_data), evt->key.timestamp);
+      }
+      break;
+    }
+    /*
+      NOTE(SR):
+        A drop may be split across pumps so the nodes live on the heap
+        and are only copied into the per pump arena once it completes.
+    */
+    case SDL_DROPBEGIN:
+    {
+      BifrostWindowSDL* const bf_window = getWindow(evt->drop.windowID);
+
+      if (bf_window)
+      {
+        freeDroppedPaths(bf_window);
+      }
+      break;
+    }
+    case SDL_DROPFILE:
+    {
+      BifrostWindowSDL* const bf_window = getWindow(evt->drop.windowID);
+
+      if (bf_window && BifrostWindowBase_wantsEvent(&bf_window->super, BIFROST_EVT_ON_FILE_DROP))
+      {
+        const size_t       path_size = SDL_strlen(evt->drop.file) + 1u;
+        DroppedPath* const node      = bfPlatformAlloc(sizeof(DroppedPath) + path_size);
+
+        if (node)
+        {
+          SDL_memcpy(node->path, evt->drop.file, path_size);
+          node->next            = NULL;
+          node->path_size       = path_size;
+          *bf_window->drop_tail = node;
+          bf_window->drop_tail  = &node->next;
+          ++bf_window->drop_count;
+        }
+      }
+
+      SDL_free(evt->drop.file);
+      break;
+    }
+    case SDL_DROPTEXT:
+    {
+      SDL_free(evt->drop.file);
+      break;
+    }
+    case SDL_DROPCOMPLETE:
     {
-      case SDL_WINDOWEVENT:
+      BifrostWindowSDL* const bf_window = getWindow(evt->drop.windowID);
+
+      if (bf_window && bf_window->drop_count)
       {
-        SDL_WindowEvent*        window_close_evt = &evt.window;
-        SDL_Window* const       sdl_window       = SDL_GetWindowFromID(window_close_evt->windowID);
-        BifrostWindowSDL* const bf_window        = SDL_GetWindowData(sdl_window, k_bfWindowUserStorageID);
+        const DroppedPath* node             = bf_window->drop_head;
+        const size_t       paths_array_size = sizeof(const char*) * bf_window->drop_count;
+        size_t             paths_total_size = 0u;
 
-        // [https://wiki.libsdl.org/SDL_WindowEvent]
-        switch (window_close_evt->event)
+        while (node)
         {
-          case SDL_WINDOWEVENT_CLOSE:
+          paths_total_size += node->path_size;
+          node = node->next;
+        }
+
+        const char** const paths = bfPlatformFrameAlloc(paths_array_size + paths_total_size, sizeof(const char*));
+
+        if (paths)
+        {
+          char*  path_data = (char*)paths + paths_array_size;
+          size_t i         = 0u;
+
+          node = bf_window->drop_head;
+
+          while (node)
           {
-            bf_window->wants_to_close = bfTrue;
-            break;
+            SDL_memcpy(path_data, node->path, node->path_size);
+            paths[i++] = path_data;
+            path_data += node->path_size;
+            node = node->next;
           }
+
+          bfFileDropEvent evt_data = bfFileDropEvent_make(paths, bf_window->drop_count);
+
+          dispatchTimestampedEvent(bf_window, bfEvent_make(BIFROST_EVT_ON_FILE_DROP, 0x0, evt_data), evt->drop.timestamp);
         }
+      }
 
-        break;
+      if (bf_window)
+      {
+        freeDroppedPaths(bf_window);
       }
+      break;
+    }
+    case SDL_CONTROLLERDEVICEADDED:
+    {
+      openGameController(evt->cdevice.which);
+      break;
+    }
+    case SDL_CONTROLLERDEVICEREMOVED:
+    {
+      closeGameController(evt->cdevice.which);
+      break;
+    }
+    case SDL_TEXTINPUT:
+    {
+      BifrostWindowSDL* const bf_window = getWindow(evt->text.windowID);
 
-      case SDL_KEYDOWN:
+      if (bf_window)
       {
-        printf("(%s). KEY DOWN EVENT (%i)\n", evt.key.repeat ? "repeat" : "first", evt.key.keysym.sym);
-        break;
+        /* NOTE(SR): SDL already hands out UTF-8 so it is passed straight through. */
+        bfPlatformDispatchText(&bf_window->super.super, evt->text.text, SDL_strlen(evt->text.text), convertTimestamp(evt->text.timestamp));
+      }
+      break;
+    }
+    case SDL_MOUSEMOTION:
+    {
+      BifrostWindowSDL* const bf_window = getWindow(evt->motion.windowID);
+
+      if (bf_window)
+      {
+        bfMouseEvent       move_data   = bfMouseEvent_make(evt->motion.x, evt->motion.y, (uint8_t)BIFROST_BUTTON_NONE, convertButtonState(evt->motion.state));
+        bfMouseMotionEvent motion_data = bfMouseMotionEvent_make((float)evt->motion.x, (float)evt->motion.y, (float)evt->motion.xrel, (float)evt->motion.yrel);
+
+        dispatchTimestampedEvent(bf_window, bfEvent_make(BIFROST_EVT_ON_MOUSE_MOVE, 0x0, move_data), evt->motion.timestamp);
+        dispatchTimestampedEvent(bf_window, bfEvent_make(BIFROST_EVT_ON_MOUSE_MOTION, 0x0, motion_data), evt->motion.timestamp);
+      }
+      break;
+    }
+    case SDL_MOUSEBUTTONDOWN:
+    case SDL_MOUSEBUTTONUP:
+    {
+      BifrostWindowSDL* const bf_window = getWindow(evt->button.windowID);
+
+      if (bf_window)
+      {
+        const bfEventType evt_type      = evt->type == SDL_MOUSEBUTTONDOWN ? BIFROST_EVT_ON_MOUSE_DOWN : BIFROST_EVT_ON_MOUSE_UP;
+        const uint8_t     target_button = convertButton(evt->button.button);
+
+        if (target_button != (uint8_t)BIFROST_BUTTON_NONE)
+        {
+          if (evt_type == BIFROST_EVT_ON_MOUSE_DOWN)
+          {
+            bf_window->button_state |= target_button;
+          }
+          else
+          {
+            bf_window->button_state &= (bfButtonFlags)~target_button;
+          }
+        }
+
+        bfMouseEvent evt_data = bfMouseEvent_make(evt->button.x, evt->button.y, target_button, bf_window->button_state);
+
+        dispatchTimestampedEvent(bf_window, bfEvent_make(evt_type, 0x0, evt_data), evt->button.timestamp);
       }
+      break;
     }
+    case SDL_MOUSEWHEEL:
+    {
+      BifrostWindowSDL* const bf_window = getWindow(evt->wheel.windowID);
+
+      if (bf_window)
+      {
+        const double       direction = evt->wheel.direction == SDL_MOUSEWHEEL_FLIPPED ? -1.0 : 1.0;
+        bfScrollWheelEvent evt_data  = bfScrollWheelEvent_make(evt->wheel.x * direction, evt->wheel.y * direction);
+
+        dispatchTimestampedEvent(bf_window, bfEvent_make(BIFROST_EVT_ON_SCROLL_WHEEL, 0x0, evt_data), evt->wheel.timestamp);
+      }
+      break;
+    }
+  }
+}
+
+static void processQueuedEvents(void)
+{
+  SDL_Event evt;
+
+  bfProfileZoneBegin("SDL_PollEvent");
+
+  while (SDL_PollEvent(&evt))
+  {
+    processEvent(&evt);
+  }
+
+  bfProfileZoneEnd();
+}
+
+void bfPlatformPumpEvents(void)
+{
+  bfPlatformBeginPumpEvents();
+  processQueuedEvents();
+  bfPlatformEndPumpEvents();
+}
+
+void bfPlatformWaitEvents(void)
+{
+  SDL_Event evt;
+
+  bfPlatformBeginPumpEvents();
+  bfProfileZoneBegin("SDL_WaitEvent");
+
+  if (SDL_WaitEvent(&evt))
+  {
+    processEvent(&evt);
+    processQueuedEvents();
+  }
+
+  bfProfileZoneEnd();
+  bfPlatformEndPumpEvents();
+}
+
+void bfPlatformWaitEventsTimeout(uint64_t timeout_ns)
+{
+  const uint64_t timeout_ms = (timeout_ns + 999999u) / 1000000u;
+  SDL_Event      evt;
+
+  bfPlatformBeginPumpEvents();
+
+  bfProfileZoneBegin("SDL_WaitEventTimeout");
+
+  if (SDL_WaitEventTimeout(&evt, timeout_ms < INT_MAX ? (int)timeout_ms : INT_MAX))
+  {
+    processEvent(&evt);
+    processQueuedEvents();
+  }
+
+  bfProfileZoneEnd();
+
+  bfPlatformEndPumpEvents();
+}
+
+void bfPlatformWakeUp(void)
+{
+  if (s_WakeUpEventType != (Uint32)-1)
+  {
+    SDL_Event evt;
+
+    SDL_zero(evt);
+    evt.type = s_WakeUpEventType;
+
+    SDL_PushEvent(&evt);
   }
 }
 
 bfWindow* bfPlatformCreateWindow(const char* title, int width, int height, uint32_t flags)
 {
-  BifrostWindowSDL* const window = bfPlatformAlloc(sizeof(BifrostWindowSDL));
+  BifrostWindowSDL* const window = bfPlatformPool_alloc(&s_WindowPool);
 
   if (window)
   {
@@ -149,7 +855,7 @@ bfWindow* bfPlatformCreateWindow(const char* title, int width, int height, uint3
 
     if (!g_CanvasContext)
     {
-      bfPlatformFree(window, sizeof(BifrostWindowSDL));
+      bfPlatformPool_free(&s_WindowPool, window);
       return NULL;
     }
 
@@ -161,24 +867,51 @@ bfWindow* bfPlatformCreateWindow(const char* title, int width, int height, uint3
 
     Uint32 window_flags = bfPlatformGetGfxAPI() == BIFROST_PLATFORM_GFX_VUlKAN ? SDL_WINDOW_VULKAN : SDL_WINDOW_OPENGL;
 
-    window->super.handle        = SDL_CreateWindow(title, SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, width, height, window_flags);
-    window->super.event_fn      = NULL;
-    window->super.frame_fn      = NULL;
-    window->super.user_data     = NULL;
-    window->super.renderer_data = NULL;
-    window->gl_context          = NULL;
-    window->wants_to_close      = bfFalse;
+    bfProfileZoneBegin("SDL_CreateWindow");
+    window->super.super.handle        = SDL_CreateWindow(title, SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, width, height, window_flags);
+    bfProfileZoneEnd();
+    window->super.super.event_fn      = NULL;
+    window->super.super.frame_fn      = NULL;
+    window->super.super.update_fn     = NULL;
+    window->super.super.user_data     = NULL;
+    window->super.super.renderer_data = NULL;
+    window->gl_context                = NULL;
+    window->wants_to_close            = bfFalse;
+    window->button_state              = 0x0;
+
+    resetDroppedPaths(window);
+
+    if (!window->super.super.handle)
+    {
+      bfPlatformPool_free(&s_WindowPool, window);
+      return NULL;
+    }
 
-    if (!window->super.handle)
+    if (!BifrostWindowBase_init(&window->super))
     {
-      bfPlatformFree(window, sizeof(BifrostWindowSDL));
+      SDL_DestroyWindow((NativeWindowHandle)window->super.super.handle);
+      bfPlatformPool_free(&s_WindowPool, window);
       return NULL;
     }
 
-    SDL_SetWindowData(window->super.handle, k_bfWindowUserStorageID, window);
+    SDL_SetWindowData(window->super.super.handle, k_bfWindowUserStorageID, window);
+    BifrostWindowBase_setFocused(&window->super, (SDL_GetWindowFlags((NativeWindowHandle)window->super.super.handle) & SDL_WINDOW_INPUT_FOCUS) != 0);
   }
 
-  return window ? &window->super : NULL;
+  return window ? &window->super.super : NULL;
+}
+
+void bfWindow_setEventMask(bfWindow* self, uint32_t mask)
+{
+  /* NOTE(SR): 'SDL_EventState' is global rather than per window so filtering happens as events are translated. */
+  windowBaseCast(self)->event_mask = mask;
+}
+
+void bfWindow_setCursorCaptured(bfWindow* self, int is_captured)
+{
+  /* NOTE(SR): Relative mode is global in SDL, it applies to whichever window has focus. */
+  windowBaseCast(self)->is_cursor_captured = is_captured != 0;
+  SDL_SetRelativeMouseMode(is_captured ? SDL_TRUE : SDL_FALSE);
 }
 
 int bfWindow_wantsToClose(bfWindow* self)
@@ -198,12 +931,29 @@ void bfWindow_setSize(bfWindow* self, int x, int y);
 
 void bfPlatformDestroyWindow(bfWindow* window)
 {
+  freeDroppedPaths(windowCast(window));
+  BifrostWindowBase_shutdown(windowBaseCast(window));
+  bfProfileZoneBegin("SDL_DestroyWindow");
   SDL_DestroyWindow((NativeWindowHandle)window->handle);
-  bfPlatformFree(window, sizeof(BifrostWindowSDL));
+  bfProfileZoneEnd();
+  bfPlatformPool_free(&s_WindowPool, window);
 }
 
 void bfPlatformQuit(void)
 {
+  int i;
+
+  for (i = 0; i < k_bfGamepadMax; ++i)
+  {
+    if (s_GameControllers[i])
+    {
+      SDL_GameControllerClose(s_GameControllers[i]);
+      s_GameControllers[i] = NULL;
+    }
+  }
+
+  bfPlatformPool_destroy(&s_WindowPool);
+  bfPlatformShutdownCommon();
   SDL_Quit();
 }
 
@@ -231,7 +981,9 @@ GLADloadproc bfPlatformGetProcAddress(void)
 
 void bfWindowGL_swapBuffers(bfWindow* self)
 {
+  bfProfileZoneBegin(__func__);
   SDL_GL_SwapWindow(self->handle);
+  bfProfileZoneEnd();
 }
 
 /******************************************************************************/
@@ -0,0 +1,289 @@
+#if defined(__linux__) && !defined(_DEFAULT_SOURCE)
+#define _DEFAULT_SOURCE /* MAP_ANONYMOUS, MAP_NORESERVE, madvise */
+#endif
+
+#include "bf/platform/bf_platform_vm.h"
+
+#include "bf/platform/bf_platform.h" /* BIFROST_PLATFORM_* */
+
+#include <assert.h> /* assert    */
+#include <stdint.h> /* uintptr_t */
+
+#if BIFROST_PLATFORM_EMSCRIPTEN
+#include <stdlib.h> /* posix_memalign, free */
+#include <string.h> /* memset               */
+#include <unistd.h> /* sysconf              */
+#elif BIFROST_PLATFORM_WINDOWS
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h> /* VirtualAlloc, VirtualFree, GetSystemInfo, GetLargePageMinimum */
+#else
+#include <stdio.h>    /* fopen, fgets, sscanf                  */
+#include <sys/mman.h> /* mmap, mprotect, madvise, munmap       */
+#include <unistd.h>   /* sysconf                               */
+#endif
+
+/*!
+ * @brief
+ *   Least a 'bfPlatformVirtualArena' commits at a time so small allocations
+ *   do not each need a trip to the OS, rounded up to whole pages.
+ */
+#ifndef BF_PLATFORM_VM_ARENA_COMMIT_SIZE
+#define BF_PLATFORM_VM_ARENA_COMMIT_SIZE 65536
+#endif
+
+#if !BIFROST_PLATFORM_WINDOWS && !BIFROST_PLATFORM_EMSCRIPTEN && !defined(MAP_ANONYMOUS)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+#if !BIFROST_PLATFORM_WINDOWS && !BIFROST_PLATFORM_EMSCRIPTEN && !defined(MAP_NORESERVE)
+#define MAP_NORESERVE 0
+#endif
+
+static size_t s_PageSize     = 0u;
+static size_t s_HugePageSize = (size_t)-1; /*!< -1 until queried since 0 is a valid answer. */
+
+static size_t roundUp(size_t value, size_t multiple)
+{
+  return (value + (multiple - 1)) / multiple * multiple;
+}
+
+size_t bfPlatformPageSize(void)
+{
+  if (!s_PageSize)
+  {
+#if BIFROST_PLATFORM_WINDOWS
+    SYSTEM_INFO info;
+
+    GetSystemInfo(&info);
+    s_PageSize = info.dwPageSize;
+#else
+    s_PageSize = (size_t)sysconf(_SC_PAGESIZE);
+#endif
+  }
+
+  return s_PageSize;
+}
+
+size_t bfPlatformHugePageSize(void)
+{
+  if (s_HugePageSize == (size_t)-1)
+  {
+#if BIFROST_PLATFORM_WINDOWS
+    s_HugePageSize = GetLargePageMinimum();
+#elif BIFROST_PLATFORM_LINUX || BIFROST_PLATFORM_ANDROID
+    FILE* const file = fopen("/proc/meminfo", "r");
+    char        line[128];
+
+    s_HugePageSize = 0u;
+
+    if (file)
+    {
+      unsigned long size_kb;
+
+      while (fgets(line, sizeof(line), file))
+      {
+        if (sscanf(line, "Hugepagesize: %lu kB", &size_kb) == 1)
+        {
+          s_HugePageSize = (size_t)size_kb * 1024u;
+          break;
+        }
+      }
+
+      fclose(file);
+    }
+#else
+    /* NOTE(SR): macOS superpages and the web have no equivalent that can be asked for this way. */
+    s_HugePageSize = 0u;
+#endif
+  }
+
+  return s_HugePageSize;
+}
+
+void* bfPlatformVirtualReserve(size_t size)
+{
+  if (!size)
+  {
+    return NULL;
+  }
+
+#if BIFROST_PLATFORM_EMSCRIPTEN
+  void* result;
+
+  size = roundUp(size, bfPlatformPageSize());
+
+  if (posix_memalign(&result, bfPlatformPageSize(), size) != 0)
+  {
+    return NULL;
+  }
+
+  return memset(result, 0x0, size);
+#elif BIFROST_PLATFORM_WINDOWS
+  return VirtualAlloc(NULL, size, MEM_RESERVE, PAGE_NOACCESS);
+#else
+  void* const result = mmap(NULL, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+  return result != MAP_FAILED ? result : NULL;
+#endif
+}
+
+/* NOTE(SR): Widens [ptr, ptr + size) out to page boundaries. */
+static void pageRange(void* ptr, size_t size, void** out_ptr, size_t* out_size)
+{
+  const size_t    page  = bfPlatformPageSize();
+  const uintptr_t begin = (uintptr_t)ptr / page * page;
+  const uintptr_t end   = roundUp((uintptr_t)ptr + size, page);
+
+  *out_ptr  = (void*)begin;
+  *out_size = (size_t)(end - begin);
+}
+
+int bfPlatformVirtualCommit(void* ptr, size_t size)
+{
+  pageRange(ptr, size, &ptr, &size);
+
+#if BIFROST_PLATFORM_EMSCRIPTEN
+  return 1;
+#elif BIFROST_PLATFORM_WINDOWS
+  return VirtualAlloc(ptr, size, MEM_COMMIT, PAGE_READWRITE) != NULL;
+#else
+  return mprotect(ptr, size, PROT_READ | PROT_WRITE) == 0;
+#endif
+}
+
+void bfPlatformVirtualDecommit(void* ptr, size_t size)
+{
+  pageRange(ptr, size, &ptr, &size);
+
+#if BIFROST_PLATFORM_EMSCRIPTEN
+  (void)ptr;
+  (void)size;
+#elif BIFROST_PLATFORM_WINDOWS
+  VirtualFree(ptr, size, MEM_DECOMMIT);
+#elif BIFROST_PLATFORM_LINUX || BIFROST_PLATFORM_ANDROID
+  madvise(ptr, size, MADV_DONTNEED);
+  mprotect(ptr, size, PROT_NONE);
+#else
+  /* NOTE(SR): 'MADV_DONTNEED' is only a hint elsewhere, mapping over the range is what reliably drops the pages. */
+  mmap(ptr, size, PROT_NONE, MAP_FIXED | MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+#endif
+}
+
+void bfPlatformVirtualRelease(void* ptr, size_t size)
+{
+  if (!ptr)
+  {
+    return;
+  }
+
+#if BIFROST_PLATFORM_EMSCRIPTEN
+  (void)size;
+  free(ptr);
+#elif BIFROST_PLATFORM_WINDOWS
+  (void)size;
+  VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+  munmap(ptr, size);
+#endif
+}
+
+int bfPlatformVirtualArena_init(bfPlatformVirtualArena* self, size_t max_size)
+{
+  self->reserved  = roundUp(max_size, bfPlatformPageSize());
+  self->base      = bfPlatformVirtualReserve(self->reserved);
+  self->committed = 0u;
+  self->used      = 0u;
+
+  if (!self->base)
+  {
+    self->reserved = 0u;
+    return 0;
+  }
+
+  return 1;
+}
+
+void* bfPlatformVirtualArena_alloc(bfPlatformVirtualArena* self, size_t size, size_t alignment)
+{
+  if (alignment == 0u)
+  {
+    alignment = sizeof(void*);
+  }
+
+  assert((alignment & (alignment - 1u)) == 0u && "Alignment must be a power of two.");
+
+  const uintptr_t base   = (uintptr_t)self->base;
+  const size_t    offset = (size_t)(((base + self->used + (alignment - 1)) & ~(uintptr_t)(alignment - 1)) - base);
+
+  if (offset > self->reserved || size > self->reserved - offset)
+  {
+    return NULL;
+  }
+
+  const size_t end = offset + size;
+
+  if (end > self->committed)
+  {
+    const size_t chunk         = roundUp(BF_PLATFORM_VM_ARENA_COMMIT_SIZE, bfPlatformPageSize());
+    const size_t wanted        = roundUp(end, chunk);
+    const size_t new_committed = wanted < self->reserved ? wanted : self->reserved;
+
+    if (!bfPlatformVirtualCommit(self->base + self->committed, new_committed - self->committed))
+    {
+      return NULL;
+    }
+
+    self->committed = new_committed;
+  }
+
+  self->used = end;
+
+  return self->base + offset;
+}
+
+void bfPlatformVirtualArena_reset(bfPlatformVirtualArena* self, int decommit)
+{
+  self->used = 0u;
+
+  if (decommit && self->committed)
+  {
+    bfPlatformVirtualDecommit(self->base, self->committed);
+    self->committed = 0u;
+  }
+}
+
+void bfPlatformVirtualArena_destroy(bfPlatformVirtualArena* self)
+{
+  bfPlatformVirtualRelease(self->base, self->reserved);
+
+  self->base      = NULL;
+  self->reserved  = 0u;
+  self->committed = 0u;
+  self->used      = 0u;
+}
+
+/******************************************************************************/
+/*
+  MIT License
+
+  Copyright (c) 2020 Shareef Abdoul-Raheem
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+/******************************************************************************/
@@ -0,0 +1,254 @@
+//
+// Gamepad Tests
+//
+// Drives the gamepad subsystem from a mocked 'bfGamepadSource' so no
+// physical pad is needed, a (hidden) window is still created since
+// that is where the connect / disconnect events are sent.
+//
+// Returns 77 when there is no display to create the window on so
+// CTest reports the test as skipped rather than failed.
+//
+
+#include "bf/Platform.h" /* Platform API */
+
+#include <math.h>   /* fabsf  */
+#include <stdio.h>  /* printf */
+#include <string.h> /* memset */
+
+#define k_SkipTestCode 77
+
+#define CHECK(cond)              checkImpl((cond), #cond, __LINE__)
+#define CHECK_NEAR(value, check) checkImpl(fabsf((value) - (check)) < 1e-4f, #value " == " #check, __LINE__)
+
+typedef struct
+{
+  uint32_t          connected; /*!< Bit per pad index. */
+  bfGamepadRawState pads[k_bfGamepadMax];
+
+} MockGamepads;
+
+typedef struct
+{
+  bfEventType type;
+  int         index;
+
+} GamepadEventLog;
+
+static MockGamepads    s_Mock;
+static GamepadEventLog s_Events[64];
+static int             s_NumEvents   = 0;
+static int             s_NumFailures = 0;
+
+static void checkImpl(int passed, const char* expression, int line)
+{
+  if (!passed)
+  {
+    printf("FAILED (line %d): %s\n", line, expression);
+    ++s_NumFailures;
+  }
+}
+
+static int mockPoll(void* user_data, int index, bfGamepadRawState* out)
+{
+  const MockGamepads* const mock = (const MockGamepads*)user_data;
+
+  if ((mock->connected >> index) & 1u)
+  {
+    *out = mock->pads[index];
+    return 1;
+  }
+
+  return 0;
+}
+
+static const char* mockName(void* user_data, int index)
+{
+  (void)user_data;
+  (void)index;
+
+  return "Mock Gamepad";
+}
+
+static void onWindowEvent(bfWindow* window, bfEvent* evt)
+{
+  (void)window;
+
+  if ((evt->type == BIFROST_EVT_ON_GAMEPAD_CONNECTED || evt->type == BIFROST_EVT_ON_GAMEPAD_DISCONNECTED) &&
+      s_NumEvents < (int)(sizeof(s_Events) / sizeof(s_Events[0])))
+  {
+    s_Events[s_NumEvents].type  = evt->type;
+    s_Events[s_NumEvents].index = evt->gamepad.index;
+    ++s_NumEvents;
+  }
+}
+
+// Pumps once and returns how many gamepad events that sent.
+static int pump(void)
+{
+  s_NumEvents = 0;
+  bfPlatformPumpEvents();
+
+  return s_NumEvents;
+}
+
+static void setPad(int index, float left_x, float left_y, float left_trigger, uint32_t buttons)
+{
+  bfGamepadRawState* const pad = &s_Mock.pads[index];
+
+  memset(pad, 0x0, sizeof(*pad));
+  pad->axes[BIFROST_GAMEPAD_AXIS_LEFT_X]       = left_x;
+  pad->axes[BIFROST_GAMEPAD_AXIS_LEFT_Y]       = left_y;
+  pad->axes[BIFROST_GAMEPAD_AXIS_LEFT_TRIGGER] = left_trigger;
+  pad->buttons                                 = buttons;
+  s_Mock.connected |= 1u << index;
+}
+
+static void testConnectionEvents(void)
+{
+  s_Mock.connected = 0u;
+  CHECK(pump() == 0);
+
+  setPad(0, 0.0f, 0.0f, 0.0f, 0x0);
+  setPad(3, 0.0f, 0.0f, 0.0f, 0x0);
+
+  CHECK(pump() == 2);
+  CHECK(s_Events[0].type == BIFROST_EVT_ON_GAMEPAD_CONNECTED && s_Events[0].index == 0);
+  CHECK(s_Events[1].type == BIFROST_EVT_ON_GAMEPAD_CONNECTED && s_Events[1].index == 3);
+  CHECK(bfGamepad_isConnected(0) && bfGamepad_isConnected(3) && !bfGamepad_isConnected(1));
+  CHECK(bfGamepad_name(0) != NULL && bfGamepad_name(1) == NULL);
+
+  // Nothing changed so nothing is sent.
+  CHECK(pump() == 0);
+
+  s_Mock.connected &= ~(1u << 0);
+
+  CHECK(pump() == 1);
+  CHECK(s_Events[0].type == BIFROST_EVT_ON_GAMEPAD_DISCONNECTED && s_Events[0].index == 0);
+  CHECK(!bfGamepad_isConnected(0) && bfGamepad_isConnected(3));
+
+  // Out of range indices are never connected.
+  CHECK(!bfGamepad_isConnected(-1) && !bfGamepad_isConnected(k_bfGamepadMax));
+
+  s_Mock.connected = 0u;
+  (void)pump();
+}
+
+static void testMaskedDisconnect(bfWindow* window)
+{
+  const uint32_t old_mask = bfWindow_eventMask(window);
+
+  setPad(2, 0.0f, 0.0f, 0.0f, 0x0);
+  CHECK(pump() == 1);
+
+  bfWindow_setEventMask(window, old_mask & ~bfEventTypeMask(BIFROST_EVT_ON_GAMEPAD_DISCONNECTED));
+
+  s_Mock.connected &= ~(1u << 2);
+
+  // The event is masked out but the polled state still has to see the pad go away.
+  CHECK(pump() == 0);
+  CHECK(!bfGamepad_isConnected(2));
+  CHECK(bfGamepad_axis(2, BIFROST_GAMEPAD_AXIS_LEFT_X) == 0.0f);
+
+  bfWindow_setEventMask(window, old_mask);
+
+  // Unmasking does not replay the disconnect that was dropped.
+  CHECK(pump() == 0);
+
+  setPad(2, 0.0f, 0.0f, 0.0f, 0x0);
+  CHECK(pump() == 1);
+  CHECK(s_Events[0].type == BIFROST_EVT_ON_GAMEPAD_CONNECTED && s_Events[0].index == 2);
+
+  s_Mock.connected = 0u;
+  (void)pump();
+}
+
+static void testDeadzones(void)
+{
+  bfPlatformSetGamepadDeadzone(0.2f, 0.1f);
+
+  // Inside both deadzones, half way through the range outside, past the unit circle and full deflection on one axis.
+  setPad(0, 0.1f, 0.1f, 0.05f, 0x0);
+  setPad(1, 0.6f, 0.0f, 0.55f, 0x0);
+  setPad(2, 1.0f, 1.0f, 1.0f, 0x0);
+  setPad(5, 0.0f, -1.0f, 0.0f, bfGamepadButtonMask(BIFROST_GAMEPAD_BUTTON_A));
+  (void)pump();
+
+  CHECK_NEAR(bfGamepad_axis(0, BIFROST_GAMEPAD_AXIS_LEFT_X), 0.0f);
+  CHECK_NEAR(bfGamepad_axis(0, BIFROST_GAMEPAD_AXIS_LEFT_Y), 0.0f);
+  CHECK_NEAR(bfGamepad_axis(0, BIFROST_GAMEPAD_AXIS_LEFT_TRIGGER), 0.0f);
+
+  CHECK_NEAR(bfGamepad_axis(1, BIFROST_GAMEPAD_AXIS_LEFT_X), 0.5f);
+  CHECK_NEAR(bfGamepad_axis(1, BIFROST_GAMEPAD_AXIS_LEFT_Y), 0.0f);
+  CHECK_NEAR(bfGamepad_axis(1, BIFROST_GAMEPAD_AXIS_LEFT_TRIGGER), 0.5f);
+
+  // The stick is clamped to length 1 keeping its direction.
+  CHECK_NEAR(bfGamepad_axis(2, BIFROST_GAMEPAD_AXIS_LEFT_X), 0.70710678f);
+  CHECK_NEAR(bfGamepad_axis(2, BIFROST_GAMEPAD_AXIS_LEFT_Y), 0.70710678f);
+  CHECK_NEAR(bfGamepad_axis(2, BIFROST_GAMEPAD_AXIS_LEFT_TRIGGER), 1.0f);
+
+  CHECK_NEAR(bfGamepad_axis(5, BIFROST_GAMEPAD_AXIS_LEFT_Y), -1.0f);
+  CHECK(bfGamepad_isButtonDown(5, BIFROST_GAMEPAD_BUTTON_A));
+  CHECK(bfGamepad_wasButtonPressed(5, BIFROST_GAMEPAD_BUTTON_A));
+
+  // Disconnected pads in between read as zero.
+  CHECK_NEAR(bfGamepad_axis(4, BIFROST_GAMEPAD_AXIS_LEFT_X), 0.0f);
+
+  // A new deadzone applies on the next pump.
+  bfPlatformSetGamepadDeadzone(0.5f, 0.0f);
+  (void)pump();
+
+  CHECK_NEAR(bfGamepad_axis(1, BIFROST_GAMEPAD_AXIS_LEFT_X), 0.2f);
+  CHECK_NEAR(bfGamepad_axis(1, BIFROST_GAMEPAD_AXIS_LEFT_TRIGGER), 0.55f);
+  CHECK(bfGamepad_isButtonDown(5, BIFROST_GAMEPAD_BUTTON_A));
+  CHECK(!bfGamepad_wasButtonPressed(5, BIFROST_GAMEPAD_BUTTON_A));
+
+  s_Mock.pads[5].buttons = 0x0;
+  (void)pump();
+
+  CHECK(bfGamepad_wasButtonReleased(5, BIFROST_GAMEPAD_BUTTON_A));
+
+  bfPlatformSetGamepadDeadzone(0.2f, 0.1f);
+  s_Mock.connected = 0u;
+  (void)pump();
+}
+
+int main(int argc, char* argv[])
+{
+  const bfGamepadSource source = {&s_Mock, &mockPoll, &mockName};
+  bfPlatformInitParams  params;
+
+  memset(&params, 0x0, sizeof(params));
+  params.argc = argc;
+  params.argv = argv;
+
+  if (!bfPlatformInit(params))
+  {
+    printf("Failed to initialize the platform, skipping.\n");
+    return k_SkipTestCode;
+  }
+
+  bfWindow* const window = bfPlatformCreateWindow("Gamepad Test", 64, 64, k_bfWindowFlagsDefault & ~k_bfWindowFlagIsVisible);
+
+  if (!window)
+  {
+    printf("Failed to create the window, skipping.\n");
+    bfPlatformQuit();
+    return k_SkipTestCode;
+  }
+
+  window->event_fn = &onWindowEvent;
+
+  bfPlatformSetGamepadSource(&source);
+
+  testConnectionEvents();
+  testMaskedDisconnect(window);
+  testDeadzones();
+
+  bfPlatformSetGamepadSource(NULL);
+  bfPlatformDestroyWindow(window);
+  bfPlatformQuit();
+
+  printf("%s\n", s_NumFailures ? "Gamepad tests FAILED." : "Gamepad tests passed.");
+
+  return s_NumFailures ? 1 : 0;
+}
@@ -0,0 +1,114 @@
+//
+// CPU Usage of an Idle Event Loop
+//
+// Runs an event loop with nothing happening for a few seconds, first
+// spinning on 'bfPlatformPumpEvents' (what 'BF_PLATFORM_REDRAW_CONTINUOUS'
+// does) and then blocking in 'bfPlatformWaitEventsTimeout' (what
+// 'BF_PLATFORM_REDRAW_ON_DEMAND' does), and prints the share of a core
+// each one used. Keep the mouse off the window while it runs.
+//
+
+#include "bf/Platform.h" /* Platform API */
+
+#if _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h> /* GetProcessTimes */
+#else
+#include <sys/resource.h> /* getrusage */
+#endif
+
+#include <stdio.h>  /* printf  */
+#include <stdlib.h> /* strtod  */
+#include <string.h> /* memset  */
+
+// User + kernel time this process has used so far.
+static uint64_t processCPUTimeNs(void)
+{
+#if _WIN32
+  FILETIME creation_time, exit_time, kernel_time, user_time;
+
+  GetProcessTimes(GetCurrentProcess(), &creation_time, &exit_time, &kernel_time, &user_time);
+
+  // FILETIMEs count 100ns intervals.
+  return ((((uint64_t)kernel_time.dwHighDateTime << 32) | kernel_time.dwLowDateTime) +
+          (((uint64_t)user_time.dwHighDateTime << 32) | user_time.dwLowDateTime)) *
+         100u;
+#else
+  struct rusage usage;
+
+  getrusage(RUSAGE_SELF, &usage);
+
+  return ((uint64_t)usage.ru_utime.tv_sec + (uint64_t)usage.ru_stime.tv_sec) * 1000000000u +
+         ((uint64_t)usage.ru_utime.tv_usec + (uint64_t)usage.ru_stime.tv_usec) * 1000u;
+#endif
+}
+
+static void benchIdle(const char* name, int wait_for_events, uint64_t duration_ns)
+{
+  const uint64_t start_cpu  = processCPUTimeNs();
+  const uint64_t start_time = bfPlatformTimeNowNs();
+  const uint64_t end_time   = start_time + duration_ns;
+  uint64_t       now        = start_time;
+  size_t         num_loops  = 0u;
+
+  while (now < end_time)
+  {
+    if (wait_for_events)
+    {
+      bfPlatformWaitEventsTimeout(end_time - now);
+    }
+    else
+    {
+      bfPlatformPumpEvents();
+    }
+
+    ++num_loops;
+    now = bfPlatformTimeNowNs();
+  }
+
+  const double cpu_ns  = (double)(processCPUTimeNs() - start_cpu);
+  const double wall_ns = (double)(now - start_time);
+
+  printf("  %-28s %7.2f%% of a core, %zu loops\n", name, 100.0 * cpu_ns / wall_ns, num_loops);
+}
+
+int main(int argc, char* argv[])
+{
+  // An optional duration in seconds for each loop.
+  const double         seconds     = argc > 1 ? strtod(argv[1], NULL) : 3.0;
+  const uint64_t       duration_ns = (uint64_t)((seconds > 0.0 ? seconds : 3.0) * 1000000000.0);
+  bfPlatformInitParams params;
+
+  memset(&params, 0x0, sizeof(params));
+  params.argc = argc;
+  params.argv = argv;
+
+  if (!bfPlatformInit(params))
+  {
+    printf("Failed to initialize the platform.\n");
+    return 1;
+  }
+
+  bfWindow* const window = bfPlatformCreateWindow("Idle Bench", 320, 240, k_bfWindowFlagIsVisible | k_bfWindowFlagIsDecorated);
+
+  if (!window)
+  {
+    printf("Failed to create the window.\n");
+    bfPlatformQuit();
+    return 2;
+  }
+
+  // Let the window finish showing so its startup events are not counted.
+  bfPlatformWaitEventsTimeout(250000000u);
+  bfPlatformPumpEvents();
+
+  printf("CPU used while idle over %.1fs each.\n\n", (double)duration_ns / 1000000000.0);
+
+  benchIdle("bfPlatformPumpEvents:", 0, duration_ns);
+  benchIdle("bfPlatformWaitEventsTimeout:", 1, duration_ns);
+
+  bfPlatformDestroyWindow(window);
+  bfPlatformQuit();
+
+  return 0;
+}
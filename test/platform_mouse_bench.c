@@ -0,0 +1,124 @@
+//
+// Per Event Cost of GLFW Mouse Moves
+//
+// Feeds synthetic cursor moves straight into the backend's registered
+// cursor callback and times them with the cached 'bfButtonFlags' (how the
+// backend works now) against also rebuilding the flags by querying every
+// button like the old 'convertButtonState' did.
+//
+// GLFW only, the window is hidden and never needs to receive real input.
+//
+
+#include "bf/Platform.h" /* Platform API */
+
+#include <glfw/glfw3.h> /* glfwSetCursorPosCallback, glfwGetMouseButton */
+
+#include <stdio.h>  /* printf */
+#include <string.h> /* memset */
+
+#define k_NumEvents 1000000
+
+static size_t           s_NumEventsReceived = 0u;
+static bfButtonFlags    s_ButtonStateSink   = 0x0;
+static GLFWcursorposfun s_CursorCallback    = NULL;
+
+static void onWindowEvent(bfWindow* window, bfEvent* evt)
+{
+  (void)window;
+
+  s_ButtonStateSink ^= evt->mouse.button_state;
+  ++s_NumEventsReceived;
+}
+
+// What every mouse event used to do before the button state was cached.
+static bfButtonFlags queryButtonState(GLFWwindow* window)
+{
+  bfButtonFlags result = 0x0;
+  int           i;
+
+  for (i = GLFW_MOUSE_BUTTON_1; i <= GLFW_MOUSE_BUTTON_LAST; ++i)
+  {
+    if (glfwGetMouseButton(window, i) == GLFW_PRESS)
+    {
+      result |= (bfButtonFlags)(1 << i);
+    }
+  }
+
+  return result;
+}
+
+static double benchMoves(GLFWwindow* window, int query_buttons)
+{
+  const uint64_t start = bfPlatformTimeNowNs();
+  int            i;
+
+  for (i = 0; i < k_NumEvents; ++i)
+  {
+    if (query_buttons)
+    {
+      s_ButtonStateSink ^= queryButtonState(window);
+    }
+
+    s_CursorCallback(window, (double)(i & 1023), (double)(i >> 10 & 1023));
+  }
+
+  return (double)(bfPlatformTimeNowNs() - start) / k_NumEvents;
+}
+
+int main(int argc, char* argv[])
+{
+  bfPlatformInitParams params;
+
+  memset(&params, 0x0, sizeof(params));
+  params.argc = argc;
+  params.argv = argv;
+
+  if (!bfPlatformInit(params))
+  {
+    printf("Failed to initialize the platform.\n");
+    return 1;
+  }
+
+  bfWindow* const window = bfPlatformCreateWindow("Mouse Bench", 64, 64, k_bfWindowFlagsDefault & ~k_bfWindowFlagIsVisible);
+
+  if (!window)
+  {
+    printf("Failed to create the window.\n");
+    bfPlatformQuit();
+    return 2;
+  }
+
+  GLFWwindow* const glfw_window = (GLFWwindow*)window->handle;
+
+  window->event_fn = &onWindowEvent;
+
+  // Setting a callback hands back the old one, that is the only way to get at the backend's.
+  s_CursorCallback = glfwSetCursorPosCallback(glfw_window, NULL);
+  glfwSetCursorPosCallback(glfw_window, s_CursorCallback);
+
+  if (!s_CursorCallback)
+  {
+    printf("The backend did not register a cursor callback.\n");
+    bfPlatformDestroyWindow(window);
+    bfPlatformQuit();
+    return 3;
+  }
+
+  // Warm up, then run each twice so the order they run in does not matter.
+  (void)benchMoves(glfw_window, 0);
+
+  const double cached_a  = benchMoves(glfw_window, 0);
+  const double queried_a = benchMoves(glfw_window, 1);
+  const double queried_b = benchMoves(glfw_window, 1);
+  const double cached_b  = benchMoves(glfw_window, 0);
+
+  printf("%d mouse moves, nanoseconds per event (best of two).\n\n", k_NumEvents);
+  printf("  cached button state:  %8.2f\n", cached_a < cached_b ? cached_a : cached_b);
+  printf("  queried every button: %8.2f\n", queried_a < queried_b ? queried_a : queried_b);
+  printf("\n(%zu events delivered, sink 0x%X)\n", s_NumEventsReceived, (unsigned)s_ButtonStateSink);
+
+  bfPlatformDestroyWindow(window);
+  bfPlatformQuit();
+
+  return 0;
+}
@@ -0,0 +1,160 @@
+//
+// Throughput of 'bfPlatformPool' against malloc / free
+//
+// Each pattern is run for a few object sizes, 'bulk' allocates every object
+// then frees them all and 'churn' keeps a window of objects alive while
+// freeing and allocating at random inside of it.
+//
+
+#include "bf/Platform.h" /* Platform API */
+
+#include <stdio.h>  /* printf         */
+#include <stdlib.h> /* malloc, free   */
+#include <string.h> /* memset         */
+
+#define k_NumObjects 100000
+#define k_NumChurns  1000000
+#define k_ChurnLive  1024
+
+typedef struct
+{
+  void* (*alloc)(void* user_data, size_t size);
+  void (*free)(void* user_data, void* ptr);
+  void* user_data;
+
+} Allocator;
+
+static void* s_Objects[k_NumObjects];
+
+static void* mallocAlloc(void* user_data, size_t size)
+{
+  (void)user_data;
+  return malloc(size);
+}
+
+static void mallocFree(void* user_data, void* ptr)
+{
+  (void)user_data;
+  free(ptr);
+}
+
+static void* poolAlloc(void* user_data, size_t size)
+{
+  (void)size;
+  return bfPlatformPool_alloc((bfPlatformPool*)user_data);
+}
+
+static void poolFree(void* user_data, void* ptr)
+{
+  bfPlatformPool_free((bfPlatformPool*)user_data, ptr);
+}
+
+// Writing to each object keeps the compiler from removing the calls and counts the cost of touching the memory.
+static void touch(void* ptr)
+{
+  *(volatile unsigned char*)ptr = 0xAB;
+}
+
+static double benchBulk(const Allocator* allocator, size_t size)
+{
+  const uint64_t start = bfPlatformTimeNowNs();
+  int            i;
+
+  for (i = 0; i < k_NumObjects; ++i)
+  {
+    s_Objects[i] = allocator->alloc(allocator->user_data, size);
+    touch(s_Objects[i]);
+  }
+
+  for (i = 0; i < k_NumObjects; ++i)
+  {
+    allocator->free(allocator->user_data, s_Objects[i]);
+  }
+
+  return (double)(bfPlatformTimeNowNs() - start) / (2.0 * k_NumObjects);
+}
+
+static double benchChurn(const Allocator* allocator, size_t size)
+{
+  uint32_t rng = 0x12345678u;
+  uint64_t start;
+  int      i;
+
+  for (i = 0; i < k_ChurnLive; ++i)
+  {
+    s_Objects[i] = allocator->alloc(allocator->user_data, size);
+  }
+
+  start = bfPlatformTimeNowNs();
+
+  for (i = 0; i < k_NumChurns; ++i)
+  {
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+
+    void** const slot = &s_Objects[rng & (k_ChurnLive - 1)];
+
+    allocator->free(allocator->user_data, *slot);
+    *slot = allocator->alloc(allocator->user_data, size);
+    touch(*slot);
+  }
+
+  const double ns_per_op = (double)(bfPlatformTimeNowNs() - start) / (2.0 * k_NumChurns);
+
+  for (i = 0; i < k_ChurnLive; ++i)
+  {
+    allocator->free(allocator->user_data, s_Objects[i]);
+  }
+
+  return ns_per_op;
+}
+
+int main(int argc, char* argv[])
+{
+  static const size_t k_Sizes[] = {16u, 64u, 256u, 1024u};
+
+  bfPlatformInitParams params;
+  size_t               i;
+
+  memset(&params, 0x0, sizeof(params));
+  params.argc = argc;
+  params.argv = argv;
+
+  if (!bfPlatformInit(params))
+  {
+    printf("Failed to initialize the platform.\n");
+    return 1;
+  }
+
+  printf("nanoseconds per alloc or free.\n\n");
+  printf("  size |  bulk malloc    bulk pool | churn malloc   churn pool\n");
+
+  for (i = 0; i < sizeof(k_Sizes) / sizeof(k_Sizes[0]); ++i)
+  {
+    const Allocator malloc_allocator = {&mallocAlloc, &mallocFree, NULL};
+    bfPlatformPool  pool;
+
+    memset(&pool, 0x0, sizeof(pool));
+    bfPlatformPool_init(&pool, k_Sizes[i], 0u);
+
+    const Allocator pool_allocator = {&poolAlloc, &poolFree, &pool};
+
+    // The first bulk run grows the pool, the second one measures reusing its blocks like malloc reuses the heap.
+    (void)benchBulk(&pool_allocator, k_Sizes[i]);
+    (void)benchBulk(&malloc_allocator, k_Sizes[i]);
+
+    const double bulk_malloc  = benchBulk(&malloc_allocator, k_Sizes[i]);
+    const double bulk_pool    = benchBulk(&pool_allocator, k_Sizes[i]);
+    const double churn_malloc = benchChurn(&malloc_allocator, k_Sizes[i]);
+    const double churn_pool   = benchChurn(&pool_allocator, k_Sizes[i]);
+
+    printf("%6u | %12.2f %12.2f | %12.2f %12.2f\n", (unsigned)k_Sizes[i], bulk_malloc, bulk_pool, churn_malloc, churn_pool);
+
+    bfPlatformPool_destroy(&pool);
+  }
+
+  bfPlatformQuit();
+
+  return 0;
+}
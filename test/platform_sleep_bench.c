@@ -0,0 +1,81 @@
+//
+// Wake Up Jitter of 'bfPlatformSleepUntil'
+//
+// Sleeps to a series of deadlines and prints how late each wake up was,
+// use it when tuning 'BF_PLATFORM_SLEEP_SPIN_TIME' / '_MIN' / '_MAX'.
+//
+
+#include "bf/Platform.h" /* Platform API */
+
+#include <stdio.h>  /* printf          */
+#include <stdlib.h> /* qsort, strtoul  */
+
+#define k_NumSamples 500
+
+static int compareU64(const void* lhs, const void* rhs)
+{
+  const uint64_t a = *(const uint64_t*)lhs;
+  const uint64_t b = *(const uint64_t*)rhs;
+
+  return (a > b) - (a < b);
+}
+
+static void measurePeriod(uint64_t period_ns, uint64_t* samples)
+{
+  uint64_t deadline = bfPlatformTimeNowNs();
+  uint64_t total    = 0u;
+  int      i;
+
+  for (i = 0; i < k_NumSamples; ++i)
+  {
+    deadline += period_ns;
+    bfPlatformSleepUntil(deadline);
+
+    samples[i] = bfPlatformTimeNowNs() - deadline;
+    total += samples[i];
+
+    // A deadline already in the past would not sleep at all, keep the next one in the future.
+    if (samples[i] > period_ns)
+    {
+      deadline = bfPlatformTimeNowNs();
+    }
+  }
+
+  qsort(samples, k_NumSamples, sizeof(*samples), &compareU64);
+
+  printf("%11.3f | %9.3f %9.3f %9.3f %9.3f %9.3f\n",
+         (double)period_ns / 1000000.0,
+         (double)samples[0] / 1000.0,
+         (double)samples[k_NumSamples / 2] / 1000.0,
+         (double)samples[k_NumSamples * 99 / 100] / 1000.0,
+         (double)samples[k_NumSamples - 1] / 1000.0,
+         (double)total / k_NumSamples / 1000.0);
+}
+
+int main(int argc, char* argv[])
+{
+  static const uint64_t k_Periods[] = {500000u, 1000000u, 2000000u, 4000000u, 16666667u};
+
+  static uint64_t samples[k_NumSamples];
+
+  // An optional period in microseconds replaces the default set.
+  const uint64_t period_ns = argc > 1 ? (uint64_t)strtoul(argv[1], NULL, 10) * 1000u : 0u;
+  size_t         i;
+
+  printf("%d wake ups per period, lateness in microseconds.\n\n", k_NumSamples);
+  printf("period (ms) |       min    median       p99       max      mean\n");
+
+  if (period_ns)
+  {
+    measurePeriod(period_ns, samples);
+  }
+  else
+  {
+    for (i = 0; i < sizeof(k_Periods) / sizeof(k_Periods[0]); ++i)
+    {
+      measurePeriod(k_Periods[i], samples);
+    }
+  }
+
+  return 0;
+}